@@ -0,0 +1,184 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Computes several column-integrated quantities in one pass over the columns.
+#include "ColumnSumEvaluator.hh"
+#include "activelayer_average_temp_evaluator.hh"
+#include "thaw_depth_evaluator.hh"
+#include "water_table_depth_evaluator.hh"
+#include "column_diagnostics_evaluator.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+ColumnDiagnosticsEvaluator::ColumnDiagnosticsEvaluator(Teuchos::ParameterList& plist)
+  : EvaluatorSecondaryMonotypeCV(plist)
+{
+  // my keys are one per integrand
+  Key domain = Keys::getDomain(my_keys_.front().first);
+  Tag tag = my_keys_.front().second;
+  my_keys_.clear();
+
+  Teuchos::ParameterList& integrands = plist_.sublist("integrands");
+  for (const auto& entry : integrands) {
+    if (!integrands.isSublist(entry.first)) continue;
+    Teuchos::ParameterList& int_list = integrands.sublist(entry.first);
+
+    KeyTag key_tag{ Keys::getKey(domain, entry.first), tag };
+    my_keys_.emplace_back(key_tag);
+    names_.emplace_back(entry.first);
+    types_.emplace_back(int_list.get<std::string>("integrand type"));
+
+    KeyTagSet deps = parseIntegrand_(types_.back(), int_list, key_tag);
+    dependencies_.insert(deps.begin(), deps.end());
+    integrand_deps_.emplace_back(std::move(deps));
+  }
+
+  if (my_keys_.empty()) {
+    Errors::Message msg;
+    msg << "ColumnDiagnosticsEvaluator for \"" << plist_.name()
+        << "\": list \"integrands\" must include at least one integrand.";
+    Exceptions::amanzi_throw(msg);
+  }
+}
+
+
+Teuchos::RCP<Evaluator>
+ColumnDiagnosticsEvaluator::Clone() const
+{
+  return Teuchos::rcp(new ColumnDiagnosticsEvaluator(*this));
+}
+
+
+KeyTagSet
+ColumnDiagnosticsEvaluator::parseIntegrand_(const std::string& type,
+                                            Teuchos::ParameterList& plist,
+                                            const KeyTag& key_tag)
+{
+  if (type == "column sum") {
+    return Impl::ParserColumnSum(plist, key_tag).dependencies;
+  } else if (type == "thaw depth") {
+    return ParserThawDepth(plist, key_tag).dependencies;
+  } else if (type == "water table depth") {
+    return ParserWaterTableDepth(plist, key_tag).dependencies;
+  } else if (type == "active layer average temperature") {
+    return ParserActiveLayerAverageTemp(plist, key_tag).dependencies;
+  }
+  Errors::Message msg;
+  msg << "ColumnDiagnosticsEvaluator: unknown \"integrand type\" \"" << type << "\" for \""
+      << key_tag.first << "\".";
+  Exceptions::amanzi_throw(msg);
+  return KeyTagSet();
+}
+
+
+std::unique_ptr<Impl::ColumnIntegrand>
+ColumnDiagnosticsEvaluator::createIntegrand_(const std::string& type,
+                                             Teuchos::ParameterList& plist,
+                                             std::vector<const Epetra_MultiVector*>& deps,
+                                             const AmanziMesh::Mesh* mesh)
+{
+  if (type == "column sum") {
+    return std::make_unique<Impl::ColumnIntegrandT<Impl::IntegratorColumnSum>>(plist, deps, mesh);
+  } else if (type == "thaw depth") {
+    return std::make_unique<Impl::ColumnIntegrandT<IntegratorThawDepth>>(plist, deps, mesh);
+  } else if (type == "water table depth") {
+    return std::make_unique<Impl::ColumnIntegrandT<IntegratorWaterTableDepth>>(plist, deps, mesh);
+  }
+  AMANZI_ASSERT(type == "active layer average temperature");
+  return std::make_unique<Impl::ColumnIntegrandT<IntegratorActiveLayerAverageTemp>>(
+    plist, deps, mesh);
+}
+
+
+// Implements custom EC to use dependencies from subsurface for surface
+// vector.
+void
+ColumnDiagnosticsEvaluator::EnsureCompatibility_ToDeps_(State& S)
+{
+  const auto& fac = S.Require<CompositeVector, CompositeVectorSpace>(my_keys_.front().first,
+                                                                     my_keys_.front().second);
+  if (fac.Mesh() != Teuchos::null) {
+    CompositeVectorSpace dep_fac;
+    dep_fac.SetMesh(fac.Mesh()->parent())
+      ->SetGhosted(true)
+      ->AddComponent("cell", AmanziMesh::CELL, 1);
+
+    for (const auto& dep : dependencies_) {
+      if (Keys::getDomain(dep.first) == Keys::getDomain(my_keys_.front().first)) {
+        S.Require<CompositeVector, CompositeVectorSpace>(dep.first, dep.second).Update(fac);
+      } else {
+        S.Require<CompositeVector, CompositeVectorSpace>(dep.first, dep.second).Update(dep_fac);
+      }
+    }
+  }
+}
+
+
+void
+ColumnDiagnosticsEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
+{
+  auto mesh = result[0]->Mesh()->parent();
+  int ncols = result[0]->ViewComponent("cell", false)->MyLength();
+
+  // column topology does not change, so flatten it once
+  if (col_offsets_.empty()) {
+    col_offsets_.resize(ncols + 1, 0);
+    for (int col = 0; col != ncols; ++col) {
+      const auto& col_cell = mesh->cells_of_column(col);
+      col_offsets_[col + 1] = col_offsets_[col] + col_cell.size();
+      col_cells_.insert(col_cells_.end(), col_cell.begin(), col_cell.end());
+    }
+  }
+
+  // instantiate the integrators
+  int n_ints = names_.size();
+  std::vector<std::unique_ptr<Impl::ColumnIntegrand>> integrands;
+  std::vector<Epetra_MultiVector*> results;
+  for (int k = 0; k != n_ints; ++k) {
+    std::vector<const Epetra_MultiVector*> deps;
+    for (const auto& dep : integrand_deps_[k]) {
+      deps.emplace_back(
+        S.Get<CompositeVector>(dep.first, dep.second).ViewComponent("cell", false).get());
+    }
+    integrands.emplace_back(
+      createIntegrand_(types_[k], plist_.sublist("integrands").sublist(names_[k]), deps, &*mesh));
+    results.emplace_back(result[k]->ViewComponent("cell", false).get());
+  }
+
+  // a single sweep over each column, scanning all integrands that are not
+  // yet complete
+  std::vector<AmanziGeometry::Point> vals(n_ints);
+  std::vector<bool> completed(n_ints);
+  for (int col = 0; col != ncols; ++col) {
+    int n_completed = 0;
+    for (int k = 0; k != n_ints; ++k) {
+      vals[k] = AmanziGeometry::Point(0., 0.);
+      completed[k] = false;
+    }
+
+    for (int i = col_offsets_[col]; i != col_offsets_[col + 1] && n_completed < n_ints; ++i) {
+      for (int k = 0; k != n_ints; ++k) {
+        if (!completed[k] && integrands[k]->scan(col, col_cells_[i], vals[k])) {
+          completed[k] = true;
+          n_completed++;
+        }
+      }
+    }
+
+    // see EvaluatorColumnIntegrator for the meaning of vals
+    for (int k = 0; k != n_ints; ++k) {
+      double coef = integrands[k]->coefficient(col);
+      (*results[k])[0][col] = vals[k][1] > 0. ? coef * vals[k][0] / vals[k][1] : coef * vals[k][0];
+    }
+  }
+}
+
+} // namespace Relations
+} // namespace Amanzi
@@ -0,0 +1,132 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Computes several column-integrated quantities in one pass over the columns.
+/*!
+
+Each column integrator (thaw depth, water table depth, etc) is, on its own, a
+full pass through the subsurface data.  When several are needed, e.g. as
+diagnostics for each surface cell, this evaluator computes all of them in a
+single traversal of each column.  Each integrand works exactly as its
+stand-alone evaluator, and each sublist of `"integrands`" takes the options of
+that evaluator.
+
+The name of each sublist of `"integrands`" is the variable name of a
+calculated surface field, in the same domain as this evaluator's key.
+
+Evaluator name: `"column diagnostics`"
+
+.. _column-diagnostics-evaluator-spec:
+.. admonition:: column-diagnostics-evaluator-spec
+
+   * `"integrands`" ``[list]`` A list of named sublists, each with:
+
+     * `"integrand type`" ``[string]`` One of `"column sum`", `"thaw
+       depth`", `"water table depth`", or `"active layer average
+       temperature`".
+
+     plus the options of the corresponding evaluator, e.g.
+     `column-sum-evaluator-spec`_.
+
+*/
+
+#pragma once
+
+#include <memory>
+
+#include "Factory.hh"
+#include "EvaluatorSecondaryMonotype.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+namespace Impl {
+
+// Type-erased integrator, so that different integrands can share a sweep.
+class ColumnIntegrand {
+ public:
+  virtual ~ColumnIntegrand() = default;
+  virtual int scan(AmanziMesh::Entity_ID col, AmanziMesh::Entity_ID c, AmanziGeometry::Point& p) = 0;
+  virtual double coefficient(AmanziMesh::Entity_ID col) = 0;
+};
+
+template <class Integrator>
+class ColumnIntegrandT : public ColumnIntegrand {
+ public:
+  ColumnIntegrandT(Teuchos::ParameterList& plist,
+                   std::vector<const Epetra_MultiVector*>& deps,
+                   const AmanziMesh::Mesh* mesh)
+    : integrator_(plist, deps, mesh)
+  {}
+
+  int scan(AmanziMesh::Entity_ID col, AmanziMesh::Entity_ID c, AmanziGeometry::Point& p) override
+  {
+    return integrator_.scan(col, c, p);
+  }
+  double coefficient(AmanziMesh::Entity_ID col) override { return integrator_.coefficient(col); }
+
+ private:
+  Integrator integrator_;
+};
+
+} // namespace Impl
+
+
+class ColumnDiagnosticsEvaluator : public EvaluatorSecondaryMonotypeCV {
+ public:
+  explicit ColumnDiagnosticsEvaluator(Teuchos::ParameterList& plist);
+  ColumnDiagnosticsEvaluator(const ColumnDiagnosticsEvaluator& other) = default;
+  Teuchos::RCP<Evaluator> Clone() const override;
+
+  // Disables derivatives
+  virtual bool
+  IsDifferentiableWRT(const State& S, const Key& wrt_key, const Tag& wrt_tag) const override
+  {
+    return false;
+  }
+
+ protected:
+  // Implements custom EC to use dependencies from subsurface for surface
+  // vector.
+  virtual void EnsureCompatibility_ToDeps_(State& S) override;
+
+  // Required methods from EvaluatorSecondaryMonotypeCV
+  virtual void Evaluate_(const State& S, const std::vector<CompositeVector*>& result) override;
+
+  virtual void EvaluatePartialDerivative_(const State& S,
+                                          const Key& wrt_key,
+                                          const Tag& wrt_tag,
+                                          const std::vector<CompositeVector*>& result) override
+  {
+    AMANZI_ASSERT(false); // not reachable, IsDifferentiableWRT() always false
+  }
+
+ private:
+  static KeyTagSet
+  parseIntegrand_(const std::string& type, Teuchos::ParameterList& plist, const KeyTag& key_tag);
+  static std::unique_ptr<Impl::ColumnIntegrand>
+  createIntegrand_(const std::string& type,
+                   Teuchos::ParameterList& plist,
+                   std::vector<const Epetra_MultiVector*>& deps,
+                   const AmanziMesh::Mesh* mesh);
+
+ private:
+  std::vector<std::string> names_;
+  std::vector<std::string> types_;
+  std::vector<KeyTagSet> integrand_deps_;
+
+  // flattened cells_of_column(), built on first evaluation
+  std::vector<int> col_offsets_;
+  std::vector<AmanziMesh::Entity_ID> col_cells_;
+
+  static Utils::RegisteredFactory<Evaluator, ColumnDiagnosticsEvaluator> reg_;
+};
+
+} // namespace Relations
+} // namespace Amanzi
@@ -11,6 +11,7 @@
 #include "activelayer_average_temp_evaluator.hh"
 #include "thaw_depth_evaluator.hh"
 #include "water_table_depth_evaluator.hh"
+#include "column_diagnostics_evaluator.hh"
 
 
 namespace Amanzi {
@@ -28,6 +29,8 @@ Utils::RegisteredFactory<Evaluator, ThawDepthEvaluator> ThawDepthEvaluator::reg_
 template <>
 Utils::RegisteredFactory<Evaluator, WaterTableDepthEvaluator>
   WaterTableDepthEvaluator::reg_("water table depth");
+Utils::RegisteredFactory<Evaluator, ColumnDiagnosticsEvaluator>
+  ColumnDiagnosticsEvaluator::reg_("column diagnostics");
 
 } // namespace Relations
 } // namespace Amanzi
@@ -6,8 +6,16 @@
 
   Authors:
 */
-}
-}
-else if (wrt_key == { var } _key_)
+
+#include <mpi.h>
+
+#include <TestReporterStdout.h>
+#include "Teuchos_GlobalMPISession.hpp"
+#include <UnitTest++.h>
+
+int
+main(int argc, char* argv[])
 {
-  {
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  return UnitTest::RunAllTests();
+}
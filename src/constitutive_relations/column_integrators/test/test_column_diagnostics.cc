@@ -0,0 +1,224 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+// Checks that each integrand of ColumnDiagnosticsEvaluator matches its
+// stand-alone EvaluatorColumnIntegrator on a columnar mesh.
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "Teuchos_Array.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+
+#include "AmanziComm.hh"
+#include "GeometricModel.hh"
+#include "MeshFactory.hh"
+#include "EvaluatorPrimary.hh"
+#include "State.hh"
+
+#include "ColumnSumEvaluator.hh"
+#include "activelayer_average_temp_evaluator.hh"
+#include "thaw_depth_evaluator.hh"
+#include "water_table_depth_evaluator.hh"
+#include "column_diagnostics_evaluator.hh"
+
+using namespace Amanzi;
+using namespace Amanzi::Relations;
+
+namespace {
+
+const Tag tag = Tags::DEFAULT;
+
+struct ColumnProblem {
+  ColumnProblem()
+  {
+    auto comm = getDefaultComm();
+
+    // a 4 x 3 x 10 box, with columns below the top face
+    Teuchos::ParameterList regions("regions");
+    auto& plane = regions.sublist("surface").sublist("region: plane");
+    plane.set("point", Teuchos::Array<double>({ 0., 0., 2. }));
+    plane.set("normal", Teuchos::Array<double>({ 0., 0., 1. }));
+    auto gm = Teuchos::rcp(new AmanziGeometry::GeometricModel(3, regions, *comm));
+
+    AmanziMesh::MeshFactory factory(comm, gm);
+    auto mesh = factory.create(0., 0., 0., 4., 3., 2., 4, 3, 10);
+    mesh->build_columns();
+    std::vector<std::string> surf_regions{ "surface" };
+    surf = factory.create(mesh, surf_regions, AmanziMesh::FACE, true, true, false);
+    domain = mesh;
+
+    Teuchos::ParameterList state_list("state");
+    S = Teuchos::rcp(new State(state_list));
+    S->RegisterMesh("domain", mesh);
+    S->RegisterMesh("surface", surf);
+
+    // primary variables
+    for (const auto& key : { "temperature", "saturation_gas", "carbon", "cell_volume" }) {
+      requirePrimary(key, domain);
+    }
+    requirePrimary("surface-cell_volume", surf);
+
+    // stand-alone integrators
+    Teuchos::ParameterList thaw_list("surface-thaw_depth");
+    addEvaluator(Teuchos::rcp(new ThawDepthEvaluator(setTag(thaw_list))));
+
+    Teuchos::ParameterList wtd_list("surface-water_table_depth");
+    addEvaluator(Teuchos::rcp(new WaterTableDepthEvaluator(setTag(wtd_list))));
+
+    Teuchos::ParameterList sum_list("surface-carbon");
+    sum_list.set("volume averaged", true);
+    addEvaluator(Teuchos::rcp(new ColumnSumEvaluator(setTag(sum_list))));
+
+    Teuchos::ParameterList alt_list("surface-active_layer_temperature");
+    addEvaluator(Teuchos::rcp(new ActiveLayerAverageTempEvaluator(setTag(alt_list))));
+
+    // the same integrands in one sweep
+    Teuchos::ParameterList diag_list("surface-column_diagnostics");
+    auto& integrands = diag_list.sublist("integrands");
+    integrands.sublist("thaw_depth_diag").set("integrand type", "thaw depth");
+    integrands.sublist("water_table_depth_diag").set("integrand type", "water table depth");
+    auto& sum_diag = integrands.sublist("carbon_diag");
+    sum_diag.set("integrand type", "column sum");
+    sum_diag.set("summed key", "carbon");
+    sum_diag.set("volume averaged", true);
+    integrands.sublist("active_layer_temperature_diag")
+      .set("integrand type", "active layer average temperature");
+    addEvaluator(Teuchos::rcp(new ColumnDiagnosticsEvaluator(setTag(diag_list))));
+
+    S->Setup();
+
+    // column geometry is in the cell volumes
+    auto& cv = *S->GetW<CompositeVector>("cell_volume", tag, "cell_volume").ViewComponent("cell");
+    for (int c = 0; c != cv.MyLength(); ++c) cv[0][c] = domain->cell_volume(c);
+    auto& surf_cv = *S->GetW<CompositeVector>("surface-cell_volume", tag, "surface-cell_volume")
+                       .ViewComponent("cell");
+    for (int c = 0; c != surf_cv.MyLength(); ++c) surf_cv[0][c] = surf->cell_volume(c);
+    setChanged("cell_volume");
+    setChanged("surface-cell_volume");
+  }
+
+  Teuchos::ParameterList& setTag(Teuchos::ParameterList& plist)
+  {
+    plist.set("tag", tag.get());
+    return plist;
+  }
+
+  void requirePrimary(const Key& key, const Teuchos::RCP<const AmanziMesh::Mesh>& mesh)
+  {
+    S->Require<CompositeVector, CompositeVectorSpace>(key, tag, key)
+      .SetMesh(mesh)
+      ->SetGhosted(true)
+      ->AddComponent("cell", AmanziMesh::CELL, 1);
+    Teuchos::ParameterList plist(key);
+    S->SetEvaluator(key, tag, Teuchos::rcp(new EvaluatorPrimaryCV(setTag(plist))));
+  }
+
+  void addEvaluator(const Teuchos::RCP<Evaluator>& eval)
+  {
+    for (const auto& key_tag : eval->get_my_keys()) {
+      S->Require<CompositeVector, CompositeVectorSpace>(key_tag.first, tag, key_tag.first)
+        .SetMesh(surf)
+        ->SetGhosted(false)
+        ->AddComponent("cell", AmanziMesh::CELL, 1);
+      S->SetEvaluator(key_tag.first, tag, eval);
+    }
+  }
+
+  void setChanged(const Key& key)
+  {
+    auto eval = Teuchos::rcp_dynamic_cast<EvaluatorPrimaryCV>(S->GetEvaluatorPtr(key, tag));
+    eval->SetChanged();
+    S->GetRecordW(key, tag, key).set_initialized();
+  }
+
+  // Fills a subsurface field from f(column, index in column), where the
+  // index is 0 at the surface.
+  template <class F>
+  void setColumnField(const Key& key, const F& f)
+  {
+    auto& vec = *S->GetW<CompositeVector>(key, tag, key).ViewComponent("cell", false);
+    int ncols = surf->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+    for (int col = 0; col != ncols; ++col) {
+      const auto& col_cells = domain->cells_of_column(col);
+      for (int i = 0; i != col_cells.size(); ++i) vec[0][col_cells[i]] = f(col, i);
+    }
+    setChanged(key);
+  }
+
+  // Checks each integrand against its stand-alone evaluator.
+  void checkMatches()
+  {
+    for (const auto& name :
+         { "thaw_depth", "water_table_depth", "carbon", "active_layer_temperature" }) {
+      Key key = Keys::getKey("surface", name);
+      Key diag_key = key + "_diag";
+      S->GetEvaluator(key, tag).Update(*S, "test");
+      S->GetEvaluator(diag_key, tag).Update(*S, "test");
+
+      const auto& val = *S->Get<CompositeVector>(key, tag).ViewComponent("cell", false);
+      const auto& diag = *S->Get<CompositeVector>(diag_key, tag).ViewComponent("cell", false);
+      for (int col = 0; col != val.MyLength(); ++col) {
+        CHECK_CLOSE(val[0][col], diag[0][col], 1.e-12 * std::max(1., std::abs(val[0][col])));
+      }
+    }
+  }
+
+  Teuchos::RCP<const AmanziMesh::Mesh> domain;
+  Teuchos::RCP<const AmanziMesh::Mesh> surf;
+  Teuchos::RCP<State> S;
+};
+
+} // namespace
+
+
+SUITE(COLUMN_DIAGNOSTICS)
+{
+  // Column 0 is frozen, column 1 thawed, and the rest thaw to varying
+  // depths.  Column 2 is never saturated.
+  TEST_FIXTURE(ColumnProblem, MATCHES_COLUMN_INTEGRATORS)
+  {
+    setColumnField("temperature", [](int col, int i) {
+      if (col == 0) return 270.;
+      if (col == 1) return 280.;
+      return 276. - 0.4 * i - 0.5 * (col % 4);
+    });
+    setColumnField("saturation_gas", [](int col, int i) {
+      if (col == 2) return 0.1;
+      return std::max(0., 0.3 - 0.05 * i - 0.02 * (col % 5));
+    });
+    setColumnField("carbon", [](int col, int i) { return 1. + 0.1 * i + col; });
+    checkMatches();
+
+    // sanity check the extremes: no thaw, and thawed through the 2 m column
+    const auto& thaw =
+      *S->Get<CompositeVector>("surface-thaw_depth", tag).ViewComponent("cell", false);
+    CHECK_CLOSE(0., thaw[0][0], 1.e-12);
+    CHECK_CLOSE(2., thaw[0][1], 1.e-12);
+  }
+
+  // The flattened columns are reused, so a second evaluation with new data
+  // must still match.
+  TEST_FIXTURE(ColumnProblem, MATCHES_AFTER_CHANGE)
+  {
+    setColumnField("temperature", [](int col, int i) { return 275. - 0.3 * i; });
+    setColumnField("saturation_gas", [](int col, int i) { return 0.2 - 0.03 * i; });
+    setColumnField("carbon", [](int col, int i) { return 2. - 0.1 * i; });
+    checkMatches();
+
+    setColumnField("temperature", [](int col, int i) { return 274. - 0.1 * (i + col); });
+    setColumnField("saturation_gas", [](int col, int i) { return 0.1 * (col % 2) - 0.01 * i; });
+    setColumnField("carbon", [](int col, int i) { return 1. + col * i; });
+    checkMatches();
+  }
+}
@@ -36,6 +36,45 @@ class EOS {
   virtual double DMolarDensityDp(std::vector<double>& params) { return 0.; }
   virtual double DMolarDensityDC(std::vector<double>& params) { return 0.; }
 
+  // Batched versions of the above, over count entries, where params[k][i] is
+  // the k-th parameter of entry i.  Computes the density and its derivatives
+  // with respect to T, p, and C into each output that is not null.  The
+  // defaults call the pointwise methods; concrete EOS override these so that
+  // the loops may be inlined and vectorized.
+  virtual void MassDensities(int count,
+                             const std::vector<const double*>& params,
+                             double* rho,
+                             double* drho_dT,
+                             double* drho_dp,
+                             double* drho_dC)
+  {
+    std::vector<double> p(params.size());
+    for (int i = 0; i != count; ++i) {
+      for (int k = 0; k != params.size(); ++k) p[k] = params[k][i];
+      if (rho) rho[i] = MassDensity(p);
+      if (drho_dT) drho_dT[i] = DMassDensityDT(p);
+      if (drho_dp) drho_dp[i] = DMassDensityDp(p);
+      if (drho_dC) drho_dC[i] = DMassDensityDC(p);
+    }
+  }
+
+  virtual void MolarDensities(int count,
+                              const std::vector<const double*>& params,
+                              double* n,
+                              double* dn_dT,
+                              double* dn_dp,
+                              double* dn_dC)
+  {
+    std::vector<double> p(params.size());
+    for (int i = 0; i != count; ++i) {
+      for (int k = 0; k != params.size(); ++k) p[k] = params[k][i];
+      if (n) n[i] = MolarDensity(p);
+      if (dn_dT) dn_dT[i] = DMolarDensityDT(p);
+      if (dn_dp) dn_dp[i] = DMolarDensityDp(p);
+      if (dn_dC) dn_dC[i] = DMolarDensityDC(p);
+    }
+  }
+
   // If molar mass is constant, we can take some shortcuts if we need both
   // molar and mass densities.  MolarMass() is undefined if
   // !IsConstantMolarMass()
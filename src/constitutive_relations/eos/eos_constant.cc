@@ -16,6 +16,8 @@
 
 */
 
+#include <algorithm>
+
 #include "eos_constant.hh"
 
 namespace Amanzi {
@@ -26,6 +28,34 @@ EOSConstant::EOSConstant(Teuchos::ParameterList& eos_plist) : eos_plist_(eos_pli
   InitializeFromPlist_();
 };
 
+void
+EOSConstant::MassDensities(int count,
+                           const std::vector<const double*>& params,
+                           double* rho,
+                           double* drho_dT,
+                           double* drho_dp,
+                           double* drho_dC)
+{
+  if (rho) std::fill_n(rho, count, rho_);
+  if (drho_dT) std::fill_n(drho_dT, count, 0.);
+  if (drho_dp) std::fill_n(drho_dp, count, 0.);
+  if (drho_dC) std::fill_n(drho_dC, count, 0.);
+};
+
+
+void
+EOSConstant::MolarDensities(int count,
+                            const std::vector<const double*>& params,
+                            double* n,
+                            double* dn_dT,
+                            double* dn_dp,
+                            double* dn_dC)
+{
+  MassDensities(count, params, n, dn_dT, dn_dp, dn_dC);
+  scale_(count, 1. / M_, n, dn_dT, dn_dp, dn_dC);
+};
+
+
 void
 EOSConstant::InitializeFromPlist_()
 {
@@ -68,6 +68,17 @@ class EOSConstantMolarMass : public EOS {
   virtual double MolarMass() { return M_; }
 
  protected:
+  // Scales each non-null output by s, for converting batched mass densities
+  // to molar densities and vice versa.
+  static void
+  scale_(int count, double s, double* v0, double* v1, double* v2, double* v3)
+  {
+    for (double* v : { v0, v1, v2, v3 }) {
+      if (v)
+        for (int i = 0; i != count; ++i) v[i] *= s;
+    }
+  }
+
   double M_;
 };
 
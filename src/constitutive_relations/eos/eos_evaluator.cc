@@ -150,9 +150,8 @@ void
 EOSEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& results)
 {
   int num_dep = dependencies_.size();
-  std::vector<double> eos_params(num_dep);
   std::vector<const CompositeVector*> dep_cv;
-  std::vector<const Epetra_MultiVector*> dep_vec(num_dep, nullptr);
+  std::vector<const double*> dep_vec(num_dep, nullptr);
 
   // Pull dependencies out of state.
   auto tag = my_keys_.front().second;
@@ -176,16 +175,13 @@ EOSEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& res
     for (CompositeVector::name_iterator comp = molar_dens->begin(); comp != molar_dens->end();
          ++comp) {
       for (int k = 0; k < num_dep; k++) {
-        dep_vec[k] = dep_cv[k]->ViewComponent(*comp, false).get();
+        dep_vec[k] = (*dep_cv[k]->ViewComponent(*comp, false))[0];
       }
 
       auto& dens_v = *(molar_dens->ViewComponent(*comp, false));
       int count = dens_v.MyLength();
-      for (int id = 0; id != count; ++id) {
-        for (int k = 0; k < num_dep; k++) { eos_params[k] = (*dep_vec[k])[0][id]; }
-        dens_v[0][id] = eos_->MolarDensity(eos_params);
-        AMANZI_ASSERT(dens_v[0][id] > 0);
-      }
+      eos_->MolarDensities(count, dep_vec, dens_v[0], nullptr, nullptr, nullptr);
+      for (int id = 0; id != count; ++id) AMANZI_ASSERT(dens_v[0][id] > 0);
     }
   }
 
@@ -201,16 +197,13 @@ EOSEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& res
       } else {
         // evaluate MassDensity() directly
         for (int k = 0; k < num_dep; k++) {
-          dep_vec[k] = dep_cv[k]->ViewComponent(*comp, false).get();
+          dep_vec[k] = (*dep_cv[k]->ViewComponent(*comp, false))[0];
         }
 
         auto& dens_v = *(mass_dens->ViewComponent(*comp, false));
         int count = dens_v.MyLength();
-        for (int id = 0; id != count; ++id) {
-          for (int k = 0; k < num_dep; k++) eos_params[k] = (*dep_vec[k])[0][id];
-          dens_v[0][id] = eos_->MassDensity(eos_params);
-          AMANZI_ASSERT(dens_v[0][id] > 0);
-        }
+        eos_->MassDensities(count, dep_vec, dens_v[0], nullptr, nullptr, nullptr);
+        for (int id = 0; id != count; ++id) AMANZI_ASSERT(dens_v[0][id] > 0);
       }
     }
   }
@@ -238,9 +231,8 @@ EOSEvaluator::EvaluatePartialDerivative_(const State& S,
                                          const std::vector<CompositeVector*>& results)
 {
   int num_dep = dependencies_.size();
-  std::vector<double> eos_params(num_dep);
   std::vector<const CompositeVector*> dep_cv;
-  std::vector<const Epetra_MultiVector*> dep_vec(num_dep, nullptr);
+  std::vector<const double*> dep_vec(num_dep, nullptr);
 
   // Pull dependencies out of state.
   auto tag = my_keys_.front().second;
@@ -264,27 +256,18 @@ EOSEvaluator::EvaluatePartialDerivative_(const State& S,
     for (CompositeVector::name_iterator comp = molar_dens->begin(); comp != molar_dens->end();
          ++comp) {
       for (int k = 0; k < num_dep; k++) {
-        dep_vec[k] = dep_cv[k]->ViewComponent(*comp, false).get();
+        dep_vec[k] = (*dep_cv[k]->ViewComponent(*comp, false))[0];
       }
 
       auto& dens_v = *(molar_dens->ViewComponent(*comp, false));
       int count = dens_v.MyLength();
 
       if (wrt_key == conc_key_) {
-        for (int id = 0; id != count; ++id) {
-          for (int k = 0; k < num_dep; k++) { eos_params[k] = (*dep_vec[k])[0][id]; }
-          dens_v[0][id] = eos_->DMolarDensityDC(eos_params);
-        }
+        eos_->MolarDensities(count, dep_vec, nullptr, nullptr, nullptr, dens_v[0]);
       } else if (wrt_key == pres_key_) {
-        for (int id = 0; id != count; ++id) {
-          for (int k = 0; k < num_dep; k++) { eos_params[k] = (*dep_vec[k])[0][id]; }
-          dens_v[0][id] = eos_->DMolarDensityDp(eos_params);
-        }
+        eos_->MolarDensities(count, dep_vec, nullptr, nullptr, dens_v[0], nullptr);
       } else if (wrt_key == temp_key_) {
-        for (int id = 0; id != count; ++id) {
-          for (int k = 0; k < num_dep; k++) { eos_params[k] = (*dep_vec[k])[0][id]; }
-          dens_v[0][id] = eos_->DMolarDensityDT(eos_params);
-        }
+        eos_->MolarDensities(count, dep_vec, nullptr, dens_v[0], nullptr, nullptr);
       } else {
         AMANZI_ASSERT(false);
       }
@@ -303,27 +286,18 @@ EOSEvaluator::EvaluatePartialDerivative_(const State& S,
       } else {
         // evaluate DMassDensity() directly
         for (int k = 0; k < num_dep; k++) {
-          dep_vec[k] = dep_cv[k]->ViewComponent(*comp, false).get();
+          dep_vec[k] = (*dep_cv[k]->ViewComponent(*comp, false))[0];
         }
 
         auto& dens_v = *(mass_dens->ViewComponent(*comp, false));
         int count = dens_v.MyLength();
 
         if (wrt_key == conc_key_) {
-          for (int id = 0; id != count; ++id) {
-            for (int k = 0; k < num_dep; k++) eos_params[k] = (*dep_vec[k])[0][id];
-            dens_v[0][id] = eos_->DMassDensityDC(eos_params);
-          }
+          eos_->MassDensities(count, dep_vec, nullptr, nullptr, nullptr, dens_v[0]);
         } else if (wrt_key == pres_key_) {
-          for (int id = 0; id != count; ++id) {
-            for (int k = 0; k < num_dep; k++) eos_params[k] = (*dep_vec[k])[0][id];
-            dens_v[0][id] = eos_->DMassDensityDp(eos_params);
-          }
+          eos_->MassDensities(count, dep_vec, nullptr, nullptr, dens_v[0], nullptr);
         } else if (wrt_key == temp_key_) {
-          for (int id = 0; id != count; ++id) {
-            for (int k = 0; k < num_dep; k++) eos_params[k] = (*dep_vec[k])[0][id];
-            dens_v[0][id] = eos_->DMassDensityDT(eos_params);
-          }
+          eos_->MassDensities(count, dep_vec, nullptr, dens_v[0], nullptr, nullptr);
         } else {
           AMANZI_ASSERT(false);
         }
@@ -38,6 +38,19 @@ class EOSIce : public EOSConstantMolarMass {
   virtual double DMassDensityDp(std::vector<double>& params) override;
   virtual double DMassDensityDC(std::vector<double>& params) override { return 0; }
 
+  virtual void MassDensities(int count,
+                             const std::vector<const double*>& params,
+                             double* rho,
+                             double* drho_dT,
+                             double* drho_dp,
+                             double* drho_dC) override;
+  virtual void MolarDensities(int count,
+                              const std::vector<const double*>& params,
+                              double* n,
+                              double* dn_dT,
+                              double* dn_dp,
+                              double* dn_dC) override;
+
   virtual bool IsTemperature() override { return true; }
   virtual bool IsPressure() override { return true; }
   virtual bool IsConcentration() override { return false; }
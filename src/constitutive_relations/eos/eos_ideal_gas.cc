@@ -14,6 +14,8 @@
 
 */
 
+#include <algorithm>
+
 #include "eos_ideal_gas.hh"
 
 namespace Amanzi {
@@ -50,6 +52,42 @@ EOSIdealGas::DMolarDensityDp(std::vector<double>& params)
 };
 
 
+void
+EOSIdealGas::MolarDensities(int count,
+                            const std::vector<const double*>& params,
+                            double* n,
+                            double* dn_dT,
+                            double* dn_dp,
+                            double* dn_dC)
+{
+  const double* T = params[0];
+  const double* p = params[1];
+  if (n) {
+    for (int i = 0; i != count; ++i) n[i] = std::max(p[i], 101325.) / (R_ * T[i]);
+  }
+  if (dn_dT) {
+    for (int i = 0; i != count; ++i) dn_dT[i] = -std::max(p[i], 101325.) / (R_ * T[i] * T[i]);
+  }
+  if (dn_dp) {
+    for (int i = 0; i != count; ++i) dn_dp[i] = 1.0 / (R_ * T[i]);
+  }
+  if (dn_dC) std::fill_n(dn_dC, count, 0.);
+};
+
+
+void
+EOSIdealGas::MassDensities(int count,
+                           const std::vector<const double*>& params,
+                           double* rho,
+                           double* drho_dT,
+                           double* drho_dp,
+                           double* drho_dC)
+{
+  MolarDensities(count, params, rho, drho_dT, drho_dp, drho_dC);
+  scale_(count, M_, rho, drho_dT, drho_dp, drho_dC);
+};
+
+
 void
 EOSIdealGas::InitializeFromPlist_()
 {
@@ -16,6 +16,8 @@
 
 */
 
+#include <algorithm>
+
 #include "eos_linear.hh"
 
 namespace Amanzi {
@@ -26,6 +28,39 @@ EOSLinear::EOSLinear(Teuchos::ParameterList& eos_plist) : eos_plist_(eos_plist)
   InitializeFromPlist_();
 };
 
+void
+EOSLinear::MassDensities(int count,
+                         const std::vector<const double*>& params,
+                         double* rho,
+                         double* drho_dT,
+                         double* drho_dp,
+                         double* drho_dC)
+{
+  const double* p = params[0];
+  if (rho) {
+    for (int i = 0; i != count; ++i) rho[i] = rho_ * (1 + beta_ * std::max(p[i] - 101325., 0.));
+  }
+  if (drho_dT) std::fill_n(drho_dT, count, 0.);
+  if (drho_dp) {
+    for (int i = 0; i != count; ++i) drho_dp[i] = p[i] > 101325. ? rho_ * beta_ : 0.;
+  }
+  if (drho_dC) std::fill_n(drho_dC, count, 0.);
+};
+
+
+void
+EOSLinear::MolarDensities(int count,
+                          const std::vector<const double*>& params,
+                          double* n,
+                          double* dn_dT,
+                          double* dn_dp,
+                          double* dn_dC)
+{
+  MassDensities(count, params, n, dn_dT, dn_dp, dn_dC);
+  scale_(count, 1. / M_, n, dn_dT, dn_dp, dn_dC);
+};
+
+
 void
 EOSLinear::InitializeFromPlist_()
 {
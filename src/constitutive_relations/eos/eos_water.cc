@@ -17,6 +17,8 @@
 
 */
 
+#include <algorithm>
+
 #include "eos_water.hh"
 
 namespace Amanzi {
@@ -75,5 +77,52 @@ EOSWater::DMassDensityDp(std::vector<double>& params)
   }
 };
 
+void
+EOSWater::MassDensities(int count,
+                        const std::vector<const double*>& params,
+                        double* rho,
+                        double* drho_dT,
+                        double* drho_dp,
+                        double* drho_dC)
+{
+  const double* T = params[0];
+  const double* p = params[1];
+  if (rho) {
+    for (int i = 0; i != count; ++i) {
+      double dT = T[i] - kT0_;
+      double rho1bar = ka_ + (kb_ + (kc_ + kd_ * dT) * dT) * dT;
+      rho[i] = rho1bar * (1.0 + kalpha_ * (std::max(p[i], 101325.) - kp0_));
+    }
+  }
+  if (drho_dT) {
+    for (int i = 0; i != count; ++i) {
+      double dT = T[i] - kT0_;
+      double rho1bar = kb_ + (2.0 * kc_ + 3.0 * kd_ * dT) * dT;
+      drho_dT[i] = rho1bar * (1.0 + kalpha_ * (std::max(p[i], 101325.) - kp0_));
+    }
+  }
+  if (drho_dp) {
+    for (int i = 0; i != count; ++i) {
+      double dT = T[i] - kT0_;
+      double rho1bar = ka_ + (kb_ + (kc_ + kd_ * dT) * dT) * dT;
+      drho_dp[i] = p[i] < 101325. ? 0. : rho1bar * kalpha_;
+    }
+  }
+  if (drho_dC) std::fill_n(drho_dC, count, 0.);
+};
+
+
+void
+EOSWater::MolarDensities(int count,
+                         const std::vector<const double*>& params,
+                         double* n,
+                         double* dn_dT,
+                         double* dn_dp,
+                         double* dn_dC)
+{
+  MassDensities(count, params, n, dn_dT, dn_dp, dn_dC);
+  scale_(count, 1. / M_, n, dn_dT, dn_dp, dn_dC);
+};
+
 } // namespace Relations
 } // namespace Amanzi
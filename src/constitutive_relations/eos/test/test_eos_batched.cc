@@ -0,0 +1,131 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+// Checks that the batched MassDensities()/MolarDensities() of each EOS that
+// overrides them match the pointwise methods.
+
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "eos_constant.hh"
+#include "eos_ice.hh"
+#include "eos_ideal_gas.hh"
+#include "eos_linear.hh"
+#include "eos_water.hh"
+
+using namespace Amanzi::Relations;
+
+namespace {
+
+// Parameters in the order EOSEvaluator passes them: concentration,
+// temperature, pressure, each only if the EOS depends on it.  Pressures
+// straddle 101325 Pa, where several EOS clip.
+std::vector<std::vector<double>>
+Params(EOS& eos, int count)
+{
+  std::vector<std::vector<double>> params;
+  if (eos.IsConcentration()) {
+    params.emplace_back(count);
+    for (int i = 0; i != count; ++i) params.back()[i] = 0.035 * i / count;
+  }
+  if (eos.IsTemperature()) {
+    params.emplace_back(count);
+    for (int i = 0; i != count; ++i) params.back()[i] = 250. + 60. * i / count;
+  }
+  if (eos.IsPressure()) {
+    params.emplace_back(count);
+    for (int i = 0; i != count; ++i) {
+      params.back()[i] = 9.e4 + 1.e7 * std::pow(double(i) / count, 3);
+    }
+  }
+  return params;
+}
+
+void
+CheckBatched(EOS& eos)
+{
+  int count = 101;
+  auto params = Params(eos, count);
+  std::vector<const double*> params_v;
+  for (const auto& p : params) params_v.push_back(p.data());
+
+  std::vector<double> rho(count), drho_dT(count), drho_dp(count), drho_dC(count);
+  std::vector<double> n(count), dn_dT(count), dn_dp(count), dn_dC(count);
+  eos.MassDensities(count, params_v, rho.data(), drho_dT.data(), drho_dp.data(), drho_dC.data());
+  eos.MolarDensities(count, params_v, n.data(), dn_dT.data(), dn_dp.data(), dn_dC.data());
+
+  std::vector<double> point(params.size());
+  for (int i = 0; i != count; ++i) {
+    for (int k = 0; k != params.size(); ++k) point[k] = params[k][i];
+
+    double tol = 1.e-12 * std::abs(eos.MassDensity(point));
+    CHECK_CLOSE(eos.MassDensity(point), rho[i], tol);
+    CHECK_CLOSE(eos.DMassDensityDT(point), drho_dT[i], tol);
+    CHECK_CLOSE(eos.DMassDensityDp(point), drho_dp[i], tol);
+    CHECK_CLOSE(eos.DMassDensityDC(point), drho_dC[i], tol);
+
+    tol = 1.e-12 * std::abs(eos.MolarDensity(point));
+    CHECK_CLOSE(eos.MolarDensity(point), n[i], tol);
+    CHECK_CLOSE(eos.DMolarDensityDT(point), dn_dT[i], tol);
+    CHECK_CLOSE(eos.DMolarDensityDp(point), dn_dp[i], tol);
+    CHECK_CLOSE(eos.DMolarDensityDC(point), dn_dC[i], tol);
+  }
+
+  // only the requested outputs are written
+  std::vector<double> rho_only(count);
+  eos.MassDensities(count, params_v, rho_only.data(), nullptr, nullptr, nullptr);
+  for (int i = 0; i != count; ++i) CHECK_EQUAL(rho[i], rho_only[i]);
+}
+
+} // namespace
+
+
+SUITE(EOS_BATCHED)
+{
+  TEST(WATER)
+  {
+    Teuchos::ParameterList plist;
+    EOSWater eos(plist);
+    CheckBatched(eos);
+  }
+
+  TEST(ICE)
+  {
+    Teuchos::ParameterList plist;
+    EOSIce eos(plist);
+    CheckBatched(eos);
+  }
+
+  TEST(IDEAL_GAS)
+  {
+    Teuchos::ParameterList plist;
+    EOSIdealGas eos(plist);
+    CheckBatched(eos);
+  }
+
+  TEST(LINEAR)
+  {
+    Teuchos::ParameterList plist;
+    plist.set<double>("density [kg/m^3]", 1000.);
+    plist.set<double>("compressibility [1/Pa]", 1.e-9);
+    EOSLinear eos(plist);
+    CheckBatched(eos);
+  }
+
+  TEST(CONSTANT)
+  {
+    Teuchos::ParameterList plist;
+    plist.set<double>("density [kg m^-3]", 1000.);
+    EOSConstant eos(plist);
+    CheckBatched(eos);
+  }
+}
@@ -7,7 +7,15 @@
   Authors:
 */
 
-const Epetra_MultiVector& { var } _v = *
+#include <mpi.h>
+
+#include <TestReporterStdout.h>
+#include "Teuchos_GlobalMPISession.hpp"
+#include <UnitTest++.h>
+
+int
+main(int argc, char* argv[])
 {
-  var
-  } -> ViewComponent(*comp, false);
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  return UnitTest::RunAllTests();
+}
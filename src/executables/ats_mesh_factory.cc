@@ -8,6 +8,12 @@
 */
 
 //! Simple wrapper that takes a ParameterList and generates all needed meshes.
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <sys/stat.h>
+
 #include "Epetra_MpiComm.h"
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_TimeMonitor.hpp"
@@ -30,6 +36,32 @@ namespace Mesh {
 
 using namespace Amanzi;
 
+//
+// Key identifying the inputs a partitioned mesh cache was built from: the
+// serial mesh file (path, size, and modification time), the partitioner, and
+// the number of processes.
+//
+// Not collective.
+static std::string
+partitionedCacheKey(const std::string& file, const std::string& partitioner, int nprocs)
+{
+  struct stat file_stat;
+  long long size = -1, mtime = -1;
+  if (stat(file.c_str(), &file_stat) == 0) {
+    size = static_cast<long long>(file_stat.st_size);
+    mtime = static_cast<long long>(file_stat.st_mtime);
+  }
+
+  std::stringstream key;
+  key << "file: " << file << std::endl
+      << "size: " << size << std::endl
+      << "mtime: " << mtime << std::endl
+      << "partitioner: " << partitioner << std::endl
+      << "nprocs: " << nprocs << std::endl;
+  return key.str();
+}
+
+
 //
 // Create a mesh from an ExodusII file
 //
@@ -45,8 +77,10 @@ createMeshFromFile(const std::string& mesh_name,
   Teuchos::ParameterList& mesh_file_plist = mesh_plist.sublist("read mesh file parameters");
   auto mesh_factory_plist = Teuchos::rcp(new Teuchos::ParameterList("mesh factory"));
 
-  // partitioner
+  // partitioner -- "columns" is map-view RCB, checked below
   std::string partitioner = mesh_plist.get<std::string>("partitioner", "zoltan_rcb");
+  bool column_partition = partitioner == "columns";
+  if (column_partition) partitioner = "zoltan_rcb";
   mesh_factory_plist->sublist("unstructured").sublist("expert").set("partitioner", partitioner);
 
   // vo
@@ -62,18 +96,63 @@ createMeshFromFile(const std::string& mesh_name,
     Exceptions::amanzi_throw(msg);
   }
 
+  // If a partitioned mesh cache exists for this number of processes and its
+  // key matches the current inputs, read it rather than reading and
+  // repartitioning the serial file.
+  std::string cache = mesh_file_plist.get<std::string>("partitioned mesh cache", "");
+  std::string cache_key, cache_key_file;
+  bool use_cache = false;
+  if (!cache.empty()) {
+    std::stringstream cache_file;
+    cache_file << cache << ".par." << comm->NumProc() << "." << comm->MyPID();
+    cache_key_file = cache + ".par.key";
+    std::string cache_partitioner = mesh_plist.get<std::string>("partitioner");
+    cache_key = partitionedCacheKey(file, cache_partitioner, comm->NumProc());
+
+    int valid_l = 0;
+    std::ifstream key_stream(cache_key_file);
+    if (key_stream.is_open() && std::ifstream(cache_file.str()).good()) {
+      std::stringstream old_key;
+      old_key << key_stream.rdbuf();
+      valid_l = old_key.str() == cache_key ? 1 : 0;
+    }
+    int valid = 0;
+    comm->MinAll(&valid_l, &valid, 1);
+    use_cache = valid == 1;
+
+    // remove a stale key before rewriting the cache, so that an interrupted
+    // rewrite is never mistaken for a valid cache
+    if (!use_cache) {
+      if (comm->MyPID() == 0) std::remove(cache_key_file.c_str());
+      comm->Barrier();
+    }
+    if (vo.os_OK(Teuchos::VERB_MEDIUM)) {
+      *vo.os() << "  " << (use_cache ? "Reading" : "Creating") << " partitioned mesh cache \""
+               << cache << ".par\"." << std::endl;
+    }
+  }
+
   // create the MSTK factory and mesh
   AmanziMesh::MeshFactory factory(comm, gm, mesh_factory_plist);
-  auto mesh = factory.create(file);
+  auto mesh = factory.create(use_cache ? cache + ".par" : file);
+  if (!cache.empty() && !use_cache && mesh != Teuchos::null) {
+    mesh->write_to_exodus_file(cache + ".par");
+    comm->Barrier();
+    if (comm->MyPID() == 0) {
+      std::ofstream key_stream(cache_key_file);
+      key_stream << cache_key;
+    }
+  }
 
   if (mesh != Teuchos::null) {
     // potentially build columns
     if (mesh_plist.isParameter("build columns from set")) {
       std::string regionname = mesh_plist.get<std::string>("build columns from set");
       mesh->build_columns(regionname);
-    } else if (mesh_plist.get("build columns", true)) {
+    } else if (mesh_plist.get("build columns", true) || column_partition) {
       mesh->build_columns();
     }
+    if (column_partition) checkColumnPartition(*mesh);
 
     // verify
     checkVerifyMesh(mesh_plist, mesh);
@@ -104,8 +183,10 @@ createMeshGenerated(const std::string& mesh_name,
   Teuchos::ParameterList& mesh_generated_plist = mesh_plist.sublist("generate mesh parameters");
   auto mesh_factory_plist = Teuchos::rcp(new Teuchos::ParameterList("mesh factory"));
 
-  // partitioner
+  // partitioner -- "columns" is map-view RCB, checked below
   std::string partitioner = mesh_plist.get<std::string>("partitioner", "zoltan_rcb");
+  bool column_partition = partitioner == "columns";
+  if (column_partition) partitioner = "zoltan_rcb";
   mesh_factory_plist->sublist("unstructured").sublist("expert").set("partitioner", partitioner);
 
   // vo
@@ -121,9 +202,10 @@ createMeshGenerated(const std::string& mesh_name,
     if (mesh_plist.isParameter("build columns from set")) {
       std::string regionname = mesh_plist.get<std::string>("build columns from set");
       mesh->build_columns(regionname);
-    } else if (mesh_plist.get("build columns", false)) {
+    } else if (mesh_plist.get("build columns", false) || column_partition) {
       mesh->build_columns();
     }
+    if (column_partition) checkColumnPartition(*mesh);
 
     // verify
     checkVerifyMesh(mesh_plist, mesh);
@@ -531,6 +613,9 @@ createDomainSetIndexed(const std::string& mesh_name_pristine,
   std::string indexing_parent_name = ds_list.get<std::string>("indexing parent domain", "domain");
 
   if (S.HasMesh(indexing_parent_name)) {
+    Teuchos::RCP<Teuchos::Time> dsettime =
+      Teuchos::TimeMonitor::getNewCounter("domain set mesh creation");
+    Teuchos::TimeMonitor timer(*dsettime);
     auto indexing_parent_mesh = S.GetMesh(indexing_parent_name);
 
     // is there a reference mesh for visualization?
@@ -552,6 +637,33 @@ createDomainSetIndexed(const std::string& mesh_name_pristine,
     // if aliased, we deal with domain sets specially
     std::string alias_target;
 
+    // A column bundle builds all columns from the one "*" spec, sharing that
+    // spec and a single copy of the parent's parameter list, rather than
+    // copying both for every column.
+    bool column_bundle = ds_list.get<bool>("column bundle", false);
+    Teuchos::RCP<const AmanziMesh::Mesh> bundle_parent;
+    Teuchos::RCP<Teuchos::ParameterList> bundle_parent_list;
+    bool bundle_deformable(false), bundle_verify(false), bundle_build_columns(false);
+    std::string bundle_columns_set;
+    if (column_bundle) {
+      const auto& bundle_list = ds_list.sublist(Keys::getDomainInSet(mesh_name, "*"));
+      if (bundle_list.get<std::string>("mesh type") != "column") {
+        Errors::Message msg;
+        msg << "Mesh \"" << mesh_name
+            << "\" is a \"column bundle\", but its subdomains are not of type \"column\".";
+        Exceptions::amanzi_throw(msg);
+      }
+      const auto& bundle_column_list = bundle_list.sublist("column parameters");
+      bundle_parent =
+        S.GetMesh(bundle_column_list.get<std::string>("parent domain", indexing_parent_name));
+      bundle_parent_list =
+        Teuchos::rcp(new Teuchos::ParameterList(*bundle_parent->parameter_list()));
+      bundle_deformable = bundle_list.get<bool>("deformable mesh", false);
+      bundle_verify = bundle_list.get<bool>("verify mesh", false);
+      bundle_columns_set = bundle_list.get<std::string>("build columns from set", "");
+      bundle_build_columns = bundle_list.get<bool>("build columns", false);
+    }
+
     // create the subdomains, indexed over entities
     for (const auto& region : regions) {
       AmanziMesh::Entity_ID_List region_ents;
@@ -566,6 +678,28 @@ createDomainSetIndexed(const std::string& mesh_name_pristine,
         subdomains.push_back(subdomain);
         std::string full_subdomain_name = Keys::getDomainInSet(mesh_name, subdomain);
 
+        if (column_bundle && !ds_list.isSublist(full_subdomain_name)) {
+          auto subdomain_mesh =
+            AmanziMesh::createColumnMesh(bundle_parent, lid, bundle_parent_list);
+          // as in createMeshColumn()
+          if (!bundle_columns_set.empty()) {
+            subdomain_mesh->build_columns(bundle_columns_set);
+          } else if (bundle_build_columns) {
+            subdomain_mesh->build_columns();
+          }
+
+          if (bundle_verify) {
+            Teuchos::ParameterList verify_list;
+            verify_list.set("verify mesh", true);
+            checkVerifyMesh(verify_list, subdomain_mesh);
+          }
+          S.RegisterMesh(full_subdomain_name, subdomain_mesh, bundle_deformable);
+
+          if (is_reference_mesh)
+            reference_maps[full_subdomain_name] = AmanziMesh::createMapToParent(*subdomain_mesh);
+          continue;
+        }
+
         // set up the parameter list
         Teuchos::ParameterList subdomain_list;
         if (ds_list.isSublist(full_subdomain_name)) {
@@ -642,6 +776,10 @@ createDomainSetIndexed(const std::string& mesh_name_pristine,
       ds = Teuchos::rcp(new AmanziMesh::DomainSet(mesh_name, indexing_parent_mesh, subdomains));
     }
     S.RegisterDomainSet(mesh_name, ds);
+    if (column_bundle && vo.os_OK(Teuchos::VERB_MEDIUM)) {
+      *vo.os() << "  Registered column bundle \"" << mesh_name << "\" of " << subdomains.size()
+               << " columns." << std::endl;
+    }
   }
 }
 
@@ -787,6 +925,34 @@ createMesh(Teuchos::ParameterList& mesh_plist,
 }
 
 
+//
+// Ensure that no column is split across processes.
+//
+// Collective on the mesh's comm.
+void
+checkColumnPartition(const AmanziMesh::Mesh& mesh)
+{
+  int ncells_owned =
+    mesh.num_entities(AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_type::OWNED);
+  int nsplit_l = 0;
+  for (int col = 0; col != mesh.num_columns(false); ++col) {
+    const auto& cells = mesh.cells_of_column(col);
+    if (std::any_of(cells.begin(), cells.end(), [=](int c) { return c >= ncells_owned; }))
+      nsplit_l++;
+  }
+
+  int nsplit = 0;
+  mesh.get_comm()->SumAll(&nsplit_l, &nsplit, 1);
+  if (nsplit > 0) {
+    Errors::Message msg;
+    msg << "ATS Mesh Factory: \"columns\" partitioner split " << nsplit
+        << " columns across processes.  Use \"build columns from set\" to identify the surface "
+        << "from which columns are extruded, or ensure the mesh is columnar.";
+    Exceptions::amanzi_throw(msg);
+  }
+}
+
+
 bool
 checkVerifyMesh(Teuchos::ParameterList& mesh_plist, Teuchos::RCP<const AmanziMesh::Mesh> mesh)
 {
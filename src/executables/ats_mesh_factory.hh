@@ -58,6 +58,10 @@ through providing a "verify mesh" option.
      - `"zoltan_rcb`" a "map view" partitioning that keeps columns of cells together
      - `"metis`" uses the METIS graph partitioner
      - `"zoltan`" uses the default Zoltan graph-based partitioner.
+     - `"columns`" the same map view partitioning as `"zoltan_rcb`", but
+       columns are always built and it is an error if any column is split
+       across processes.  Use this when column-based evaluators and PKs
+       require entire columns to be local.
 
 
 Generated Mesh
@@ -111,6 +115,14 @@ Specified by `"mesh type`" of `"read mesh file`".
 .. admonition:: mesh-read-mesh-file-spec
 
    * `"file`" ``[string]`` filename of a pre-generated mesh file
+   * `"partitioned mesh cache`" ``[string]`` **optional** If provided, the
+     partitioned mesh is written to a Nemesis set of per-process files with
+     this base name (``CACHE.par.N.r``) the first time it is read.
+     A key file, ``CACHE.par.key``, records the path, size, and modification
+     time of `"file`", the partitioner, and the number of processes.
+     Subsequent runs read the cached files directly, skipping the serial read
+     and partitioning, only if the key matches; otherwise the cache is
+     rebuilt and rewritten.
 
 Example:
 
@@ -243,6 +255,13 @@ Specified by `"mesh type`" of `"subgrid`".
    * `"parent domain`" ``[string]`` **domain** Mesh which includes the above region.
    * `"flyweight mesh`" ``[bool]`` **False** NOT YET SUPPORTED.  Allows a single
      mesh instead of one per entity.
+   * `"column bundle`" ``[bool]`` **false** If all subgrid meshes are
+     `Column Meshes`_ built from the same spec, build them as a bundle: the
+     spec and the parent mesh's parameter list are shared by all columns
+     rather than copied per column.  `"verify mesh`" still audits every
+     column.  Each column is still its own mesh, built serially.  This
+     reduces the setup time and memory spent on parameter lists for large
+     numbers of columns per process.
 
 .. todo::
    WIP: Add examples (intermediate scale model, transport subgrid model)
@@ -308,6 +327,9 @@ bool
 checkVerifyMesh(Teuchos::ParameterList& mesh_plist,
                 Teuchos::RCP<const Amanzi::AmanziMesh::Mesh> mesh);
 
+void
+checkColumnPartition(const Amanzi::AmanziMesh::Mesh& mesh);
+
 //
 // Create mesh for each type
 //
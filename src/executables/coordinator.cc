@@ -47,6 +47,7 @@ actual work.
 #include "TreeVector.hh"
 #include "PK_Factory.hh"
 #include "pk_helpers.hh"
+#include "column_geometry.hh"
 
 #include "ats_mesh_factory.hh"
 
@@ -493,6 +494,13 @@ Coordinator::advance()
   double t_old = S_->get_time(Amanzi::Tags::CURRENT);
   double t_new = S_->get_time(Amanzi::Tags::NEXT);
 
+  // remember the column geometry of deformable meshes, to be restored on fail
+  for (Amanzi::State::mesh_iterator mesh = S_->mesh_begin(); mesh != S_->mesh_end(); ++mesh) {
+    if (S_->IsDeformableMesh(mesh->first) && !S_->IsAliasedMesh(mesh->first)) {
+      Amanzi::snapshotColumnGeometry(*mesh->second.first);
+    }
+  }
+
   bool fail = pk_->AdvanceStep(t_old, t_new, false);
   if (!fail) fail |= !pk_->ValidStep();
 
@@ -521,20 +529,35 @@ Coordinator::advance()
         vc_vec->ScatterMasterToGhosted();
         const Epetra_MultiVector& vc = *vc_vec->ViewComponent("node", true);
 
-        std::vector<int> node_ids(vc.MyLength());
-        Amanzi::AmanziGeometry::Point_List old_positions(vc.MyLength());
+        // only the nodes that moved this step need to be put back
+        std::vector<int> node_ids;
+        Amanzi::AmanziGeometry::Point_List old_positions;
+        int dim = mesh->second.first->space_dimension();
+        Amanzi::AmanziGeometry::Point nc(dim);
         for (int n = 0; n != vc.MyLength(); ++n) {
-          node_ids[n] = n;
-          if (mesh->second.first->space_dimension() == 2) {
-            old_positions[n] = Amanzi::AmanziGeometry::Point(vc[0][n], vc[1][n]);
-          } else {
-            old_positions[n] = Amanzi::AmanziGeometry::Point(vc[0][n], vc[1][n], vc[2][n]);
+          mesh->second.first->node_get_coordinates(n, &nc);
+          bool moved = false;
+          for (int i = 0; i != dim; ++i) moved |= (nc[i] != vc[i][n]);
+          if (moved) {
+            node_ids.emplace_back(n);
+            if (dim == 2) {
+              old_positions.emplace_back(Amanzi::AmanziGeometry::Point(vc[0][n], vc[1][n]));
+            } else {
+              old_positions.emplace_back(
+                Amanzi::AmanziGeometry::Point(vc[0][n], vc[1][n], vc[2][n]));
+            }
           }
         }
 
-        // undeform the mesh
-        Amanzi::AmanziGeometry::Point_List final_positions;
-        mesh->second.first->deform(node_ids, old_positions, false, &final_positions);
+        // undeform the mesh, if it was deformed anywhere
+        int n_moved_l = node_ids.size();
+        int n_moved = 0;
+        mesh->second.first->get_comm()->MaxAll(&n_moved_l, &n_moved, 1);
+        if (n_moved > 0) {
+          Amanzi::AmanziGeometry::Point_List final_positions;
+          mesh->second.first->deform(node_ids, old_positions, false, &final_positions);
+        }
+        Amanzi::restoreColumnGeometry(*mesh->second.first);
       }
     }
   }
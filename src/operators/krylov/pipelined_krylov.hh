@@ -0,0 +1,386 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Pipelined, communication-hiding Krylov methods for linear solves.
+/*!
+
+At large process counts, the latency of the global reductions in dot products
+dominates the cost of standard Krylov methods.  These variants do exactly one
+global reduction per iteration, and overlap that (non-blocking) reduction with
+the application of the preconditioner and the operator.
+
+They are selected through the usual `"inverse`" list of a PK by setting the
+`"iterative method`" to one of:
+
+- `"pipelined pcg`" The pipelined preconditioned conjugate gradient method of
+  Ghysels & Vanroose, 2014.  For symmetric positive definite systems, e.g.
+  diffusion and dispersion.
+
+- `"pipelined gmres`" A right-preconditioned, restarted GMRES using classical
+  Gram-Schmidt with a single fused reduction per iteration.  The next basis
+  vector's preconditioner and operator applications are computed while that
+  reduction is in flight, by also storing the preconditioned and operator
+  images of the basis.  For general, non-symmetric systems, e.g. the coupled
+  flow-energy system.
+
+In both cases, the `"preconditioning method`" (and its parameters) in the same
+`"inverse`" list are used as the preconditioner, applied once per iteration.
+
+.. _iterative-method-pipelined-spec:
+.. admonition:: iterative-method-pipelined-spec
+
+    * `"error tolerance`" ``[double]`` **1.e-6** Tolerance, relative to the
+      norm of the right hand side, on which to declare success.
+
+    * `"maximum number of iterations`" ``[int]`` **100** Maximum iterations
+      before declaring failure.
+
+    * `"size of Krylov space`" ``[int]`` **10** Only used by `"pipelined
+      gmres`", the restart length.
+
+*/
+
+#pragma once
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "mpi.h"
+#include "Teuchos_ParameterList.hpp"
+
+#include "AmanziComm.hh"
+#include "CompositeVector.hh"
+#include "TreeVector.hh"
+#include "errors.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+//
+// Rank-local dot products, with no communication.
+//
+inline double
+localDot(const CompositeVector& a, const CompositeVector& b)
+{
+  double dot = 0.;
+  for (const auto& comp : a) {
+    const Epetra_MultiVector& a_v = *a.ViewComponent(comp, false);
+    const Epetra_MultiVector& b_v = *b.ViewComponent(comp, false);
+    for (int k = 0; k != a_v.NumVectors(); ++k) {
+      for (int i = 0; i != a_v.MyLength(); ++i) dot += a_v[k][i] * b_v[k][i];
+    }
+  }
+  return dot;
+}
+
+inline double
+localDot(const TreeVector& a, const TreeVector& b)
+{
+  if (a.Data() != Teuchos::null) return localDot(*a.Data(), *b.Data());
+
+  double dot = 0.;
+  for (int i = 0; i != a.size(); ++i) dot += localDot(*a.SubVector(i), *b.SubVector(i));
+  return dot;
+}
+
+inline MPI_Comm
+getMPIComm(const Comm_type& comm)
+{
+  const auto* mpi_comm = dynamic_cast<const MpiComm_type*>(&comm);
+  return mpi_comm != nullptr ? mpi_comm->Comm() : MPI_COMM_SELF;
+}
+
+
+//
+// Returns true if the inverse list requests a pipelined method.
+//
+inline bool
+isPipelinedKrylov(const Teuchos::ParameterList& inv_list)
+{
+  if (!inv_list.isParameter("iterative method")) return false;
+  std::string method = inv_list.get<std::string>("iterative method");
+  return method == "pipelined pcg" || method == "pipelined gmres";
+}
+
+//
+// The inverse list with the iterative method removed, so that an operator's
+// ApplyInverse() applies only the preconditioner.
+//
+inline Teuchos::ParameterList
+preconditionerOnly(const Teuchos::ParameterList& inv_list)
+{
+  Teuchos::ParameterList pc_list(inv_list);
+  if (pc_list.isParameter("iterative method")) {
+    std::string method = pc_list.get<std::string>("iterative method");
+    pc_list.remove("iterative method");
+    if (pc_list.isSublist(method + " parameters")) pc_list.remove(method + " parameters");
+  }
+  return pc_list;
+}
+
+
+//
+// Pipelined Krylov solver, wrapping an operator whose Apply() is the forward
+// operator and whose ApplyInverse() is the preconditioner.
+//
+template <class Op, class Vector>
+class PipelinedKrylov {
+ public:
+  PipelinedKrylov(const Teuchos::ParameterList& inv_list, const Teuchos::RCP<const Op>& op)
+    : op_(op), num_itrs_(0), residual_(0.), returned_code_(0)
+  {
+    method_ = inv_list.get<std::string>("iterative method");
+    Teuchos::ParameterList plist;
+    if (inv_list.isSublist(method_ + " parameters"))
+      plist = inv_list.sublist(method_ + " parameters");
+    tol_ = plist.get<double>("error tolerance", 1.e-6);
+    max_itrs_ = plist.get<int>("maximum number of iterations", 100);
+    krylov_dim_ = plist.get<int>("size of Krylov space", 10);
+
+    if (method_ != "pipelined pcg" && method_ != "pipelined gmres") {
+      Errors::Message msg;
+      msg << "PipelinedKrylov: unknown iterative method \"" << method_ << "\"";
+      Exceptions::amanzi_throw(msg);
+    }
+  }
+
+  // Solve A x = b, using x as the initial guess.  Returns a positive value on
+  // success and a negative value on failure, like Amanzi's inverses.
+  int ApplyInverse(const Vector& b, Vector& x)
+  {
+    returned_code_ = method_ == "pipelined pcg" ? PCG_(b, x) : GMRES_(b, x);
+    return returned_code_;
+  }
+
+  int num_itrs() const { return num_itrs_; }
+  double residual() const { return residual_; }
+  int returned_code() const { return returned_code_; }
+  std::string returned_code_string() const
+  {
+    if (returned_code_ > 0) return "success";
+    if (returned_code_ == -1) return "maximum number of iterations exceeded";
+    return "breakdown";
+  }
+
+ private:
+  int PCG_(const Vector& b, Vector& x);
+  int GMRES_(const Vector& b, Vector& x);
+
+ private:
+  Teuchos::RCP<const Op> op_;
+  std::string method_;
+  double tol_;
+  int max_itrs_, krylov_dim_;
+
+  int num_itrs_;
+  double residual_;
+  int returned_code_;
+};
+
+
+//
+// Pipelined PCG, Ghysels & Vanroose, Parallel Computing 40 (2014).
+//
+template <class Op, class Vector>
+int
+PipelinedKrylov<Op, Vector>::PCG_(const Vector& b, Vector& x)
+{
+  MPI_Comm comm = getMPIComm(*b.Comm());
+  num_itrs_ = 0;
+
+  double bnorm;
+  b.Norm2(&bnorm);
+  if (bnorm == 0.) bnorm = 1.;
+
+  // r = b - A x, u = M r, w = A u
+  Vector r(b), u(b), w(b), m(b), n(b);
+  op_->Apply(x, r);
+  r.Update(1., b, -1.);
+  op_->ApplyInverse(r, u);
+  op_->Apply(u, w);
+
+  Vector z(b), q(b), s(b), p(b);
+  z.PutScalar(0.);
+  q.PutScalar(0.);
+  s.PutScalar(0.);
+  p.PutScalar(0.);
+
+  double gamma_old(0.), alpha(0.);
+  for (int i = 0; i != max_itrs_; ++i) {
+    // single fused reduction: (r,u), (w,u), (r,r)
+    double l_dots[3] = { localDot(r, u), localDot(w, u), localDot(r, r) };
+    double dots[3];
+    MPI_Request request;
+    MPI_Iallreduce(l_dots, dots, 3, MPI_DOUBLE, MPI_SUM, comm, &request);
+
+    // overlapped with the reduction: m = M w, n = A m
+    op_->ApplyInverse(w, m);
+    op_->Apply(m, n);
+
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+    double gamma = dots[0];
+    double delta = dots[1];
+    residual_ = std::sqrt(std::abs(dots[2])) / bnorm;
+    if (residual_ < tol_) return 1;
+
+    double beta = 0.;
+    if (i > 0) {
+      beta = gamma / gamma_old;
+      alpha = gamma / (delta - beta * gamma / alpha);
+    } else {
+      alpha = gamma / delta;
+    }
+    if (!std::isfinite(alpha)) return -2;
+
+    z.Update(1., n, beta);
+    q.Update(1., m, beta);
+    s.Update(1., w, beta);
+    p.Update(1., u, beta);
+
+    x.Update(alpha, p, 1.);
+    r.Update(-alpha, s, 1.);
+    u.Update(-alpha, q, 1.);
+    w.Update(-alpha, z, 1.);
+
+    gamma_old = gamma;
+    num_itrs_++;
+  }
+  return -1;
+}
+
+
+//
+// Right-preconditioned, restarted GMRES with a single reduction per
+// iteration.  With v_j the orthonormal basis, z_j = M v_j and w_j = A z_j are
+// also stored, so that M and A of the next (unnormalized) basis vector can be
+// applied while the reduction that normalizes it is in flight.
+//
+template <class Op, class Vector>
+int
+PipelinedKrylov<Op, Vector>::GMRES_(const Vector& b, Vector& x)
+{
+  MPI_Comm comm = getMPIComm(*b.Comm());
+  num_itrs_ = 0;
+
+  double bnorm;
+  b.Norm2(&bnorm);
+  if (bnorm == 0.) bnorm = 1.;
+
+  int m = krylov_dim_;
+  std::vector<Teuchos::RCP<Vector>> V(m + 1), Z(m + 1), W(m + 1);
+  for (int j = 0; j != m + 1; ++j) {
+    V[j] = Teuchos::rcp(new Vector(b));
+    Z[j] = Teuchos::rcp(new Vector(b));
+    W[j] = Teuchos::rcp(new Vector(b));
+  }
+  Vector zw(b), aw(b);
+
+  std::vector<double> H((m + 1) * m, 0.), cs(m, 0.), sn(m, 0.), g(m + 1, 0.), y(m, 0.);
+  std::vector<double> l_dots(m + 2), dots(m + 2);
+
+  while (num_itrs_ < max_itrs_) {
+    // restart: v_0 = r / |r|, z_0 = M v_0, w_0 = A z_0
+    op_->Apply(x, *V[0]);
+    V[0]->Update(1., b, -1.);
+    double beta;
+    V[0]->Norm2(&beta);
+    residual_ = beta / bnorm;
+    if (residual_ < tol_) return 1;
+
+    V[0]->Scale(1. / beta);
+    op_->ApplyInverse(*V[0], *Z[0]);
+    op_->Apply(*Z[0], *W[0]);
+
+    std::fill(g.begin(), g.end(), 0.);
+    g[0] = beta;
+
+    int k = 0;
+    for (; k != m && num_itrs_ < max_itrs_; ++k) {
+      // single fused reduction: (w_k, v_i) for i <= k, and (w_k, w_k)
+      for (int i = 0; i <= k; ++i) l_dots[i] = localDot(*W[k], *V[i]);
+      l_dots[k + 1] = localDot(*W[k], *W[k]);
+      MPI_Request request;
+      MPI_Iallreduce(l_dots.data(), dots.data(), k + 2, MPI_DOUBLE, MPI_SUM, comm, &request);
+
+      // overlapped with the reduction: M w_k and A M w_k
+      op_->ApplyInverse(*W[k], zw);
+      op_->Apply(zw, aw);
+
+      MPI_Wait(&request, MPI_STATUS_IGNORE);
+      double hnorm2 = dots[k + 1];
+      for (int i = 0; i <= k; ++i) {
+        H[i + k * (m + 1)] = dots[i];
+        hnorm2 -= dots[i] * dots[i];
+      }
+
+      // form the next basis vector and its images
+      *V[k + 1] = *W[k];
+      *Z[k + 1] = zw;
+      *W[k + 1] = aw;
+      for (int i = 0; i <= k; ++i) {
+        V[k + 1]->Update(-dots[i], *V[i], 1.);
+        Z[k + 1]->Update(-dots[i], *Z[i], 1.);
+        W[k + 1]->Update(-dots[i], *W[i], 1.);
+      }
+
+      // guard against cancellation in the Pythagorean norm
+      double hnext;
+      if (hnorm2 > 1.e-8 * dots[k + 1]) {
+        hnext = std::sqrt(hnorm2);
+      } else {
+        V[k + 1]->Norm2(&hnext);
+      }
+      H[k + 1 + k * (m + 1)] = hnext;
+      num_itrs_++;
+
+      if (hnext > 0.) {
+        V[k + 1]->Scale(1. / hnext);
+        Z[k + 1]->Scale(1. / hnext);
+        W[k + 1]->Scale(1. / hnext);
+      }
+
+      // apply Givens rotations to the new column of H
+      for (int i = 0; i != k; ++i) {
+        double tmp = cs[i] * H[i + k * (m + 1)] + sn[i] * H[i + 1 + k * (m + 1)];
+        H[i + 1 + k * (m + 1)] = -sn[i] * H[i + k * (m + 1)] + cs[i] * H[i + 1 + k * (m + 1)];
+        H[i + k * (m + 1)] = tmp;
+      }
+      double hkk = H[k + k * (m + 1)];
+      double denom = std::sqrt(hkk * hkk + hnext * hnext);
+      if (denom == 0.) return -2;
+      cs[k] = hkk / denom;
+      sn[k] = hnext / denom;
+      H[k + k * (m + 1)] = denom;
+      H[k + 1 + k * (m + 1)] = 0.;
+      g[k + 1] = -sn[k] * g[k];
+      g[k] = cs[k] * g[k];
+
+      residual_ = std::abs(g[k + 1]) / bnorm;
+      if (residual_ < tol_ || hnext == 0.) {
+        k++;
+        break;
+      }
+    }
+
+    // solve the upper triangular system and update x = x + Z y
+    for (int i = k - 1; i >= 0; --i) {
+      y[i] = g[i];
+      for (int l = i + 1; l != k; ++l) y[i] -= H[i + l * (m + 1)] * y[l];
+      y[i] /= H[i + i * (m + 1)];
+    }
+    for (int i = 0; i != k; ++i) x.Update(y[i], *Z[i], 1.);
+
+    if (residual_ < tol_) return 1;
+  }
+  return -1;
+}
+
+} // namespace Operators
+} // namespace Amanzi
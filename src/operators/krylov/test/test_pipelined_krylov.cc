@@ -0,0 +1,201 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+// Checks the pipelined Krylov methods against Amanzi's PCG and GMRES, and
+// that pipelined GMRES survives a breakdown of its Gram-Schmidt process.
+
+#include <cmath>
+#include "UnitTest++.h"
+
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+
+#include "AmanziComm.hh"
+#include "MeshFactory.hh"
+#include "BCs.hh"
+#include "Operator.hh"
+#include "PDE_Accumulation.hh"
+#include "PDE_AdvectionUpwind.hh"
+#include "PDE_DiffusionFactory.hh"
+
+#include "pipelined_krylov.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+Teuchos::RCP<const AmanziMesh::Mesh>
+createMesh()
+{
+  AmanziMesh::MeshFactory meshfactory(getDefaultComm());
+  return meshfactory.create(0.0, 0.0, 1.0, 1.0, 16, 16);
+}
+
+// Finite volume diffusion plus a unit accumulation term, which is SPD, and
+// optionally upwinded advection by a uniform flow in x, which is not.  The
+// inverse is set from inv_list.
+Teuchos::RCP<Operators::Operator>
+createOperator(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+               bool advection,
+               Teuchos::ParameterList inv_list)
+{
+  auto bc = Teuchos::rcp(new Operators::BCs(mesh, AmanziMesh::FACE, WhetStone::DOF_Type::SCALAR));
+
+  Teuchos::ParameterList diff_list;
+  diff_list.set("discretization primary", "fv: default");
+  diff_list.set("gravity", false);
+  Operators::PDE_DiffusionFactory opfactory;
+  auto diff = opfactory.Create(diff_list, mesh, bc);
+  auto op = diff->global_operator();
+  diff->SetScalarCoefficient(Teuchos::null, Teuchos::null);
+  diff->UpdateMatrices(Teuchos::null, Teuchos::null);
+  diff->ApplyBCs(true, true, true);
+
+  Teuchos::ParameterList acc_list;
+  acc_list.set("entity kind", "cell");
+  Operators::PDE_Accumulation acc(acc_list, op);
+  CompositeVector one(op->DomainMap());
+  one.PutScalar(1.);
+  acc.AddAccumulationTerm(one, "cell");
+
+  if (advection) {
+    CompositeVectorSpace flux_space;
+    flux_space.SetMesh(mesh)->SetGhosted()->SetComponent("face", AmanziMesh::FACE, 1);
+    CompositeVector flux(flux_space);
+    auto& flux_f = *flux.ViewComponent("face", true);
+    int nfaces = mesh->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL);
+    for (int f = 0; f != nfaces; ++f) flux_f[0][f] = 50. * mesh->face_normal(f)[0];
+
+    Teuchos::ParameterList adv_list;
+    Operators::PDE_AdvectionUpwind adv(adv_list, op);
+    adv.SetBCs(bc, bc);
+    adv.Setup(flux);
+    adv.UpdateMatrices(flux.ptr());
+    adv.ApplyBCs(false, true, false);
+  }
+
+  op->set_inverse_parameters(inv_list);
+  op->InitializeInverse();
+  op->ComputeInverse();
+  return op;
+}
+
+Teuchos::ParameterList
+inverseList(const std::string& method)
+{
+  Teuchos::ParameterList inv_list;
+  inv_list.set("preconditioning method", "diagonal");
+  if (!method.empty()) {
+    inv_list.set("iterative method", method);
+    auto& method_list = inv_list.sublist(method + " parameters");
+    method_list.set("error tolerance", 1.e-12);
+    method_list.set("maximum number of iterations", 1000);
+    method_list.set("size of Krylov space", 30);
+  }
+  return inv_list;
+}
+
+// Solves with Amanzi's method and the pipelined one, and compares.
+void
+CompareSolves(bool advection, const std::string& method)
+{
+  auto mesh = createMesh();
+  auto ref_op = createOperator(mesh, advection, inverseList(method));
+  auto pc_op = createOperator(mesh, advection, inverseList(""));
+  auto pipelined_list = inverseList("pipelined " + method);
+  Operators::PipelinedKrylov<Operators::Operator, CompositeVector> pipelined(pipelined_list,
+                                                                            pc_op);
+
+  CompositeVector b(ref_op->RangeMap()), x_ref(b), x(b), r(b);
+  b.Random();
+  x_ref.PutScalar(0.);
+  x.PutScalar(0.);
+
+  CHECK(ref_op->ApplyInverse(b, x_ref) >= 0);
+  CHECK(pipelined.ApplyInverse(b, x) > 0);
+  CHECK(pipelined.residual() < 1.e-12);
+
+  // the true residual, not just the recurrence, is small
+  double bnorm, rnorm;
+  b.Norm2(&bnorm);
+  pc_op->Apply(x, r);
+  r.Update(1., b, -1.);
+  r.Norm2(&rnorm);
+  CHECK(rnorm < 1.e-10 * bnorm);
+
+  double xnorm, dnorm;
+  x_ref.Norm2(&xnorm);
+  x.Update(-1., x_ref, 1.);
+  x.Norm2(&dnorm);
+  CHECK(dnorm < 1.e-8 * xnorm);
+}
+
+// A diagonal operator with two distinct values, and no preconditioner.  The
+// Krylov space is exhausted after two iterations, after which the
+// Gram-Schmidt residual of the next basis vector is pure roundoff.
+class TwoValueDiagonal {
+ public:
+  explicit TwoValueDiagonal(const CompositeVectorSpace& space) : d_(space)
+  {
+    auto& d_c = *d_.ViewComponent("cell", false);
+    for (int c = 0; c != d_c.MyLength(); ++c) d_c[0][c] = c % 2 ? 1. : 4.;
+  }
+
+  int Apply(const CompositeVector& x, CompositeVector& y) const
+  {
+    y.Multiply(1., d_, x, 0.);
+    return 0;
+  }
+  int ApplyInverse(const CompositeVector& x, CompositeVector& y) const
+  {
+    y = x;
+    return 0;
+  }
+
+  const CompositeVector& diagonal() const { return d_; }
+
+ private:
+  CompositeVector d_;
+};
+
+} // namespace
+
+
+SUITE(PIPELINED_KRYLOV)
+{
+  TEST(PCG_MATCHES_AMANZI_PCG) { CompareSolves(false, "pcg"); }
+
+  TEST(GMRES_MATCHES_AMANZI_GMRES) { CompareSolves(true, "gmres"); }
+
+  TEST(GMRES_BREAKDOWN)
+  {
+    auto mesh = createMesh();
+    CompositeVectorSpace space;
+    space.SetMesh(mesh)->SetComponent("cell", AmanziMesh::CELL, 1);
+    auto op = Teuchos::rcp(new TwoValueDiagonal(space));
+
+    auto inv_list = inverseList("pipelined gmres");
+    Operators::PipelinedKrylov<TwoValueDiagonal, CompositeVector> pipelined(inv_list, op);
+
+    CompositeVector b(space), x(space), x_exact(space);
+    b.Random();
+    x.PutScalar(0.);
+    x_exact.ReciprocalMultiply(1., op->diagonal(), b, 0.);
+
+    CHECK(pipelined.ApplyInverse(b, x) > 0);
+    CHECK(pipelined.num_itrs() <= 3);
+
+    double xnorm, dnorm;
+    x_exact.Norm2(&xnorm);
+    x.Update(-1., x_exact, 1.);
+    x.Norm2(&dnorm);
+    CHECK(std::isfinite(dnorm));
+    CHECK(dnorm < 1.e-10 * xnorm);
+  }
+}
@@ -0,0 +1,271 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! A cache of the geometry of the columns of a columnar mesh.
+
+#include <algorithm>
+#include <map>
+
+#include "column_geometry.hh"
+
+namespace Amanzi {
+
+namespace {
+
+struct CachedColumnGeometry {
+  // a weak handle, which tells whether the mesh this entry was computed for
+  // is still alive
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh;
+
+  bool valid = false;
+  ColumnGeometry geom;
+
+  // Step-start snapshot.  It is taken lazily: snapshotColumnGeometry() only
+  // marks it pending.  An in-place update then saves the old values of just
+  // the columns it changes into the undo buffers, while an invalidation
+  // moves the whole geometry into snapshot.
+  bool snapshot_pending = false;
+  bool snapshot_taken = false;
+  bool snapshot_valid = false;
+  ColumnGeometry snapshot;
+
+  // saved columns, in the order they were saved, and their old values
+  std::vector<int> undo_cols;
+  std::vector<double> undo_depth;
+  std::vector<double> undo_depth_mean_face;
+  std::vector<double> undo_dz;
+};
+
+std::map<const AmanziMesh::Mesh*, CachedColumnGeometry>&
+columnGeometryCache()
+{
+  static std::map<const AmanziMesh::Mesh*, CachedColumnGeometry> cache;
+  return cache;
+}
+
+// The entry of a mesh, created if needed.  An entry left by a destroyed mesh
+// at the same address is reset, so that it never sees a stale geometry.
+CachedColumnGeometry&
+getEntry(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh)
+{
+  AMANZI_ASSERT(mesh.get());
+  auto& entry = columnGeometryCache()[mesh.get()];
+  if (entry.mesh == Teuchos::null || !entry.mesh.is_valid_ptr()) {
+    entry = CachedColumnGeometry();
+    entry.mesh = mesh.create_weak();
+  }
+  return entry;
+}
+
+// the entry of a mesh, or nullptr if nothing is cached for it
+CachedColumnGeometry*
+findEntry(const AmanziMesh::Mesh& mesh)
+{
+  auto& cache = columnGeometryCache();
+  auto entry = cache.find(&mesh);
+  if (entry == cache.end()) return nullptr;
+  if (!entry->second.mesh.is_valid_ptr()) {
+    // left by a destroyed mesh at the same address
+    cache.erase(entry);
+    return nullptr;
+  }
+  return &entry->second;
+}
+
+// z-dependent quantities of one column, whose structure is already set
+void
+computeColumn(const AmanziMesh::Mesh& mesh, int col, ColumnGeometry& geom)
+{
+  int d = mesh.space_dimension() - 1;
+  const auto& col_faces = mesh.faces_of_column(col);
+
+  double top_z = mesh.face_centroid(col_faces[0])[d];
+  double z_above = top_z;
+  for (int ci = geom.offsets[col]; ci != geom.offsets[col + 1]; ++ci) {
+    int i = ci - geom.offsets[col];
+    double z_below = mesh.face_centroid(col_faces[i + 1])[d];
+    geom.depth[ci] = top_z - mesh.cell_centroid(geom.cells[ci])[d];
+    geom.depth_mean_face[ci] = top_z - (z_above + z_below) / 2;
+    geom.dz[ci] = z_above - z_below;
+    AMANZI_ASSERT(geom.dz[ci] > 0.);
+    z_above = z_below;
+  }
+}
+
+void
+computeColumnGeometry(const AmanziMesh::Mesh& mesh, ColumnGeometry& geom)
+{
+  int ncols = mesh.num_columns();
+
+  geom.offsets.resize(ncols + 1);
+  geom.offsets[0] = 0;
+  for (int col = 0; col != ncols; ++col) {
+    geom.offsets[col + 1] = geom.offsets[col] + mesh.cells_of_column(col).size();
+  }
+
+  int ncells = geom.offsets[ncols];
+  geom.cells.resize(ncells);
+  geom.top_faces.resize(ncols);
+  geom.depth.resize(ncells);
+  geom.depth_mean_face.resize(ncells);
+  geom.dz.resize(ncells);
+
+  for (int col = 0; col != ncols; ++col) {
+    const auto& col_cells = mesh.cells_of_column(col);
+    std::copy(col_cells.begin(), col_cells.end(), geom.cells.begin() + geom.offsets[col]);
+    geom.top_faces[col] = mesh.faces_of_column(col)[0];
+    computeColumn(mesh, col, geom);
+  }
+  geom.version++;
+}
+
+void
+clearUndo(CachedColumnGeometry& entry)
+{
+  // clear() keeps the capacity, so steady-state steps do not allocate
+  entry.undo_cols.clear();
+  entry.undo_depth.clear();
+  entry.undo_depth_mean_face.clear();
+  entry.undo_dz.clear();
+}
+
+// Saves the old values of these columns before an in-place update, if a
+// snapshot is pending.
+void
+saveColumns(CachedColumnGeometry& entry, const std::vector<int>& cols)
+{
+  if (!entry.snapshot_pending) return;
+  const auto& geom = entry.geom;
+  for (int col : cols) {
+    entry.undo_cols.push_back(col);
+    int begin = geom.offsets[col];
+    int end = geom.offsets[col + 1];
+    entry.undo_depth.insert(
+      entry.undo_depth.end(), geom.depth.begin() + begin, geom.depth.begin() + end);
+    entry.undo_depth_mean_face.insert(entry.undo_depth_mean_face.end(),
+                                      geom.depth_mean_face.begin() + begin,
+                                      geom.depth_mean_face.begin() + end);
+    entry.undo_dz.insert(entry.undo_dz.end(), geom.dz.begin() + begin, geom.dz.begin() + end);
+  }
+}
+
+// Writes the saved columns back, latest first so that a column saved twice
+// ends with its oldest values.  Returns true if anything was written.
+bool
+undoColumns(CachedColumnGeometry& entry)
+{
+  if (entry.undo_cols.empty()) return false;
+  auto& geom = entry.geom;
+  int i = entry.undo_depth.size();
+  for (auto col = entry.undo_cols.rbegin(); col != entry.undo_cols.rend(); ++col) {
+    int begin = geom.offsets[*col];
+    int n = geom.offsets[*col + 1] - begin;
+    i -= n;
+    std::copy_n(entry.undo_depth.begin() + i, n, geom.depth.begin() + begin);
+    std::copy_n(entry.undo_depth_mean_face.begin() + i, n, geom.depth_mean_face.begin() + begin);
+    std::copy_n(entry.undo_dz.begin() + i, n, geom.dz.begin() + begin);
+  }
+  AMANZI_ASSERT(i == 0);
+  clearUndo(entry);
+  return true;
+}
+
+// Moves the step-start geometry into the snapshot before it is invalidated or
+// recomputed, if a snapshot is pending.
+void
+takeSnapshot(CachedColumnGeometry& entry)
+{
+  if (!entry.snapshot_pending) return;
+  undoColumns(entry);
+  std::swap(entry.snapshot, entry.geom);
+  entry.geom.version = entry.snapshot.version;
+  entry.snapshot_valid = entry.valid;
+  entry.snapshot_pending = false;
+  entry.snapshot_taken = true;
+}
+
+} // namespace
+
+
+const ColumnGeometry&
+getColumnGeometry(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh)
+{
+  auto& entry = getEntry(mesh);
+  if (!entry.valid || entry.geom.num_columns() != mesh->num_columns()) {
+    takeSnapshot(entry);
+    computeColumnGeometry(*mesh, entry.geom);
+    entry.valid = true;
+  }
+  return entry.geom;
+}
+
+
+void
+updateColumnGeometry(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+                     const std::vector<int>& cols)
+{
+  auto& entry = getEntry(mesh);
+  if (!entry.valid || entry.geom.num_columns() != mesh->num_columns()) {
+    takeSnapshot(entry);
+    computeColumnGeometry(*mesh, entry.geom);
+    entry.valid = true;
+  } else {
+    saveColumns(entry, cols);
+    for (int col : cols) computeColumn(*mesh, col, entry.geom);
+    entry.geom.version++;
+  }
+}
+
+
+void
+invalidateColumnGeometry(const AmanziMesh::Mesh& mesh)
+{
+  auto entry = findEntry(mesh);
+  if (entry) {
+    takeSnapshot(*entry);
+    entry->valid = false;
+  }
+}
+
+
+void
+snapshotColumnGeometry(const AmanziMesh::Mesh& mesh)
+{
+  auto entry = findEntry(mesh);
+  if (entry) {
+    entry->snapshot_pending = true;
+    entry->snapshot_taken = false;
+    clearUndo(*entry);
+  }
+}
+
+
+void
+restoreColumnGeometry(const AmanziMesh::Mesh& mesh)
+{
+  auto entry = findEntry(mesh);
+  if (!entry) return;
+
+  if (entry->snapshot_taken) {
+    // the version must still increase, as consumers only compare for changes
+    int version = entry->geom.version;
+    std::swap(entry->snapshot, entry->geom);
+    entry->valid = entry->snapshot_valid;
+    entry->geom.version = version + 1;
+  } else if (entry->snapshot_pending) {
+    if (undoColumns(*entry)) entry->geom.version++;
+  } else {
+    // first computed during the failed step, from the moved nodes
+    entry->valid = false;
+  }
+  entry->snapshot_pending = false;
+  entry->snapshot_taken = false;
+}
+
+} // namespace Amanzi
@@ -0,0 +1,103 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! A cache of the geometry of the columns of a columnar mesh.
+/*!
+
+Many column-based PKs and evaluators need, for every column, the cells from
+the top down, each cell's depth below the surface, and its thickness.  These
+are geometric walks over cells and faces that only change when the mesh
+deforms, so they are computed once per mesh and cached here, in flat arrays.
+
+Anything that moves mesh nodes must call invalidateColumnGeometry(), after
+which the next call to getColumnGeometry() recomputes the cache and increments
+its version.  Code that knows exactly which columns it moved, and moved them
+only vertically, may instead call updateColumnGeometry() on just those
+columns.  Consumers that derive further data from it may compare versions to
+know when to rebuild.
+
+A time integrator that may have to undo a deformation of the mesh calls
+snapshotColumnGeometry() before the step and restoreColumnGeometry() after
+moving the nodes back on a failed step.  The snapshot is taken lazily: an
+updateColumnGeometry() saves the old values of only the columns it updates,
+and an invalidation moves the geometry aside without copying it.  Restoring
+writes back those columns or swaps the geometry back, rather than
+recomputing.
+
+The cache is held per mesh.  An entry whose mesh has been destroyed is
+discarded when a new mesh at the same address looks it up.  The mesh must
+have had build_columns() called.
+
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+#include "Mesh.hh"
+
+namespace Amanzi {
+
+struct ColumnGeometry {
+  // incremented each time the geometry is recomputed
+  int version = 0;
+
+  // Entries for column col are [offsets[col], offsets[col+1]), ordered from
+  // the top down.
+  std::vector<int> offsets;
+  std::vector<AmanziMesh::Entity_ID> cells;
+
+  // top face of each column, one per column
+  std::vector<AmanziMesh::Entity_ID> top_faces;
+
+  // per cell: depth of the cell centroid below the top face centroid [m]
+  std::vector<double> depth;
+
+  // per cell: depth of the mean of the cell's top and bottom face centroids
+  // below the top face centroid [m]
+  std::vector<double> depth_mean_face;
+
+  // per cell: distance between its top and bottom face centroids [m]
+  std::vector<double> dz;
+
+  int num_columns() const { return offsets.size() - 1; }
+  int num_cells(int col) const { return offsets[col + 1] - offsets[col]; }
+};
+
+
+// Returns the column geometry of this mesh, computing it if it is not cached
+// or has been invalidated.
+const ColumnGeometry&
+getColumnGeometry(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh);
+
+// Recomputes the depths and thicknesses of only the listed columns, e.g.
+// after a vertical deformation that moved only their nodes.  The column
+// structure is unchanged.  If nothing is cached, computes everything.
+void
+updateColumnGeometry(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+                     const std::vector<int>& cols);
+
+// Marks the cached column geometry of this mesh as stale.  Must be called
+// whenever the mesh's nodes are moved.
+void
+invalidateColumnGeometry(const AmanziMesh::Mesh& mesh);
+
+// Marks the current column geometry of this mesh as the one to return to on
+// restoreColumnGeometry().
+void
+snapshotColumnGeometry(const AmanziMesh::Mesh& mesh);
+
+// Restores the column geometry saved by the last snapshotColumnGeometry().
+// The caller must also have restored the mesh's node coordinates.
+void
+restoreColumnGeometry(const AmanziMesh::Mesh& mesh);
+
+} // namespace Amanzi
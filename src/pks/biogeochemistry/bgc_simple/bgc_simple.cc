@@ -21,6 +21,7 @@
 
 #include "MeshPartition.hh"
 #include "pk_helpers.hh"
+#include "column_geometry.hh"
 #include "bgc_simple_funcs.hh"
 
 #include "bgc_simple.hh"
@@ -62,6 +63,22 @@ BGCSimple::BGCSimple(Teuchos::ParameterList& pk_tree,
   wind_speed_ref_ht_ = plist_->get<double>("wind speed reference height [m]", 2.0);
   cryoturbation_coef_ = plist_->get<double>("cryoturbation mixing coefficient [cm^2/yr]", 5.0);
   cryoturbation_coef_ /= 365.25e4; // convert to m^2/day
+
+  // supercycling
+  biology_period_ = plist_->get<double>("biology period [s]", -1.);
+  forcing_time_ = 0.;
+  forcing_time_key_ = Keys::getKey(domain_, "bgc_forcing_time");
+  forcing_keys_ = { "temperature",
+                    "pressure",
+                    "surface-incoming_shortwave_radiation",
+                    "surface-air_temperature",
+                    "surface-vapor_pressure_air",
+                    "surface-wind_speed",
+                    "surface-co2_concentration" };
+  for (const auto& key : forcing_keys_) {
+    forcing_integral_keys_[key] =
+      Keys::getKey(Keys::getDomain(key), "bgc_integrated_" + Keys::getVarName(key));
+  }
 }
 
 // is a PK
@@ -242,6 +259,17 @@ BGCSimple::Setup()
   S_->Require<CompositeVector, CompositeVectorSpace>("surface-co2_concentration", tag_next_)
     .SetMesh(mesh_surf_)
     ->AddComponent("cell", AmanziMesh::CELL, 1);
+
+  // require data for checkpointing the time-integrated forcing
+  if (biology_period_ > 0.) {
+    S_->Require<double>(forcing_time_key_, Tag(name_), name_);
+    for (const auto& key : forcing_keys_) {
+      S_->Require<CompositeVector, CompositeVectorSpace>(
+          forcing_integral_keys_[key], Tag(name_), name_)
+        .SetMesh(S_->GetMesh(Keys::getDomain(key)))
+        ->SetComponent("cell", AmanziMesh::CELL, 1);
+    }
+  }
 }
 
 // -- Initialize owned (dependent) variables.
@@ -316,6 +344,22 @@ BGCSimple::Initialize()
     }
   }
 
+  // time-averaged forcing, if supercycling.  On restart, the committed
+  // integrals are overwritten by the checkpoint.
+  if (biology_period_ > 0.) {
+    S_->Assign(forcing_time_key_, Tag(name_), name_, (double)0.);
+    S_->GetRecordW(forcing_time_key_, Tag(name_), name_).set_initialized();
+    for (const auto& key : forcing_keys_) {
+      const Key& int_key = forcing_integral_keys_[key];
+      S_->GetW<CompositeVector>(int_key, Tag(name_), name_).PutScalar(0.);
+      S_->GetRecordW(int_key, Tag(name_), name_).set_initialized();
+
+      const auto& map =
+        S_->Get<CompositeVector>(int_key, Tag(name_)).ViewComponent("cell", false)->Map();
+      forcing_avg_[key] = Teuchos::rcp(new Epetra_MultiVector(map, 1));
+    }
+  }
+
   // ensure all initialization in both PFTs?  Not sure this is
   // necessary -- likely done in initial call to commit-state --etc
   for (int col = 0; col != num_cols_; ++col) {
@@ -336,6 +380,52 @@ BGCSimple::CommitStep(double told, double tnew, const Tag& tag)
   for (int col = 0; col != num_cols_; ++col) {
     for (int i = 0; i != num_pfts_; ++i) { *pfts_old_[col][i] = *pfts_[col][i]; }
   }
+
+  // and the forcing accumulated so far
+  if (biology_period_ > 0.) {
+    for (const auto& key : forcing_keys_) {
+      *S_->GetW<CompositeVector>(forcing_integral_keys_[key], Tag(name_), name_)
+         .ViewComponent("cell", false) = *forcing_avg_[key];
+    }
+    S_->Assign(forcing_time_key_, Tag(name_), name_, forcing_time_);
+  }
+}
+
+// Update the forcing and add it, weighted by dt, to the running averages.
+// Returns true, with the averages normalized, if a full biology period has
+// been accumulated.
+bool
+BGCSimple::AccumulateForcing_(double dt)
+{
+  forcing_time_ = S_->Get<double>(forcing_time_key_, Tag(name_));
+  for (const auto& key : forcing_keys_) {
+    S_->GetEvaluator(key, tag_next_).Update(*S_, name_);
+    const Epetra_MultiVector& vec =
+      *S_->Get<CompositeVector>(key, tag_next_).ViewComponent("cell", false);
+    if (forcing_time_ > 0.) {
+      const Epetra_MultiVector& committed =
+        *S_->Get<CompositeVector>(forcing_integral_keys_[key], Tag(name_))
+           .ViewComponent("cell", false);
+      forcing_avg_[key]->Update(dt, vec, 1., committed, 0.);
+    } else {
+      forcing_avg_[key]->Update(dt, vec, 0.);
+    }
+  }
+  forcing_time_ += dt;
+
+  if (forcing_time_ < (1. - 1.e-10) * biology_period_) return false;
+  for (const auto& key : forcing_keys_) { forcing_avg_[key]->Scale(1. / forcing_time_); }
+  return true;
+}
+
+
+// The forcing seen by the biology: averaged if supercycling, current otherwise.
+const Epetra_MultiVector&
+BGCSimple::GetForcing_(const Key& key)
+{
+  if (biology_period_ > 0.) return *forcing_avg_[key];
+  S_->GetEvaluator(key, tag_next_).Update(*S_, name_);
+  return *S_->Get<CompositeVector>(key, tag_next_).ViewComponent("cell", false);
 }
 
 // -- advance the model
@@ -360,6 +450,18 @@ BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit)
     for (int i = 0; i != num_pfts_; ++i) { *pfts_[col][i] = *pfts_old_[col][i]; }
   }
 
+  // If supercycling, accumulate the forcing and only run the biology, using
+  // the time-averaged forcing, once per biology period.
+  double t_start = S_->get_time(tag_current_);
+  if (biology_period_ > 0.) {
+    if (!AccumulateForcing_(dt)) return false;
+    dt = forcing_time_;
+    t_start = t_new - dt;
+    forcing_time_ = 0.;
+    if (vo_->os_OK(Teuchos::VERB_HIGH))
+      *vo_->os() << "Running biology over averaged period: h = " << dt << std::endl;
+  }
+
   // grab the required fields
   Epetra_MultiVector& sc_pools =
     *S_->GetW<CompositeVector>(key_, tag_next_, name_).ViewComponent("cell", false);
@@ -385,34 +487,13 @@ BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit)
     *S_->GetW<CompositeVector>("surface-veg_total_transpiration", tag_next_, name_)
        .ViewComponent("cell", false);
 
-  S_->GetEvaluator("temperature", tag_next_).Update(*S_, name_);
-  const Epetra_MultiVector& temp =
-    *S_->Get<CompositeVector>("temperature", tag_next_).ViewComponent("cell", false);
-
-  S_->GetEvaluator("pressure", tag_next_).Update(*S_, name_);
-  const Epetra_MultiVector& pres =
-    *S_->Get<CompositeVector>("pressure", tag_next_).ViewComponent("cell", false);
-
-  S_->GetEvaluator("surface-incoming_shortwave_radiation", tag_next_).Update(*S_, name_);
-  const Epetra_MultiVector& qSWin =
-    *S_->Get<CompositeVector>("surface-incoming_shortwave_radiation", tag_next_)
-       .ViewComponent("cell", false);
-
-  S_->GetEvaluator("surface-air_temperature", tag_next_).Update(*S_, name_);
-  const Epetra_MultiVector& air_temp =
-    *S_->Get<CompositeVector>("surface-air_temperature", tag_next_).ViewComponent("cell", false);
-
-  S_->GetEvaluator("surface-vapor_pressure_air", tag_next_).Update(*S_, name_);
-  const Epetra_MultiVector& vp_air =
-    *S_->Get<CompositeVector>("surface-vapor_pressure_air", tag_next_).ViewComponent("cell", false);
-
-  S_->GetEvaluator("surface-wind_speed", tag_next_).Update(*S_, name_);
-  const Epetra_MultiVector& wind_speed =
-    *S_->Get<CompositeVector>("surface-wind_speed", tag_next_).ViewComponent("cell", false);
-
-  S_->GetEvaluator("surface-co2_concentration", tag_next_).Update(*S_, name_);
-  const Epetra_MultiVector& co2 =
-    *S_->Get<CompositeVector>("surface-co2_concentration", tag_next_).ViewComponent("cell", false);
+  const Epetra_MultiVector& temp = GetForcing_("temperature");
+  const Epetra_MultiVector& pres = GetForcing_("pressure");
+  const Epetra_MultiVector& qSWin = GetForcing_("surface-incoming_shortwave_radiation");
+  const Epetra_MultiVector& air_temp = GetForcing_("surface-air_temperature");
+  const Epetra_MultiVector& vp_air = GetForcing_("surface-vapor_pressure_air");
+  const Epetra_MultiVector& wind_speed = GetForcing_("surface-wind_speed");
+  const Epetra_MultiVector& co2 = GetForcing_("surface-co2_concentration");
 
   // note that this is used as the column area, which is maybe not always
   // right.  Likely correct for soil carbon calculations and incorrect for
@@ -435,6 +516,13 @@ BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit)
 
   total_lai.PutScalar(0.);
 
+  // Flattened, per-rank arrays for cryoturbation, which is solved implicitly
+  // for all columns after the column loop.
+  const auto& col_geom = getColumnGeometry(mesh_);
+  int ncells_cryo = col_geom.cells.size();
+  cryo_temp_.resize(ncells_cryo);
+  cryo_som_.resize(ncells_cryo * num_pools_);
+
   // loop over columns and apply the model
   for (AmanziMesh::Entity_ID col = 0; col != num_cols_; ++col) {
     // update the various soil arrays
@@ -467,10 +555,10 @@ BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit)
     sw_c = met.qSWin;
 
     // call the model
-    BGCAdvance(S_->get_time(tag_current_),
+    BGCAdvance(t_start,
                dt,
                scv[0][col],
-               cryoturbation_coef_,
+               0., // cryoturbation is done below, for all columns
                met,
                *temp_c,
                *pres_c,
@@ -482,11 +570,13 @@ BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit)
                trans_c,
                sw_c);
 
-    // copy back
+    // copy back, carbon pools into the cryoturbation arrays
     // -- serious cache thrash... --etc
     for (std::size_t i = 0; i != col_iter.size(); ++i) {
-      for (int p = 0; p != soil_carbon_pools_[col][i]->nPools; ++p) {
-        sc_pools[p][col_iter[i]] = soil_carbon_pools_[col][i]->SOM[p];
+      int ci = col_geom.offsets[col] + i;
+      cryo_temp_[ci] = (*temp_c)[i];
+      for (int p = 0; p != num_pools_; ++p) {
+        cryo_som_[ci * num_pools_ + p] = soil_carbon_pools_[col][i]->SOM[p];
       }
 
       // and integrate the decomp
@@ -510,6 +600,25 @@ BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit)
 
   } // end loop over columns
 
+  // cryoturbation, then copy the carbon pools back
+  if (cryoturbation_coef_ > 0.) {
+    std::vector<double> cryo_coefs(num_pools_, cryoturbation_coef_);
+    CryoturbateImplicit(dt / 86400.,
+                        col_geom.offsets,
+                        cryo_temp_.data(),
+                        col_geom.depth.data(),
+                        col_geom.dz.data(),
+                        num_pools_,
+                        cryo_coefs,
+                        cryo_som_.data(),
+                        cryo_work_);
+  }
+  for (int ci = 0; ci != ncells_cryo; ++ci) {
+    for (int p = 0; p != num_pools_; ++p) {
+      sc_pools[p][col_geom.cells[ci]] = cryo_som_[ci * num_pools_ + p];
+    }
+  }
+
   // mark primaries as changed
   changedEvaluatorPrimary(trans_key_, tag_next_, *S_);
   changedEvaluatorPrimary(shaded_sw_key_, tag_next_, *S_);
@@ -551,43 +660,12 @@ BGCSimple::ColDepthDz_(AmanziMesh::Entity_ID col,
                        Teuchos::Ptr<Epetra_SerialDenseVector> depth,
                        Teuchos::Ptr<Epetra_SerialDenseVector> dz)
 {
-  AmanziMesh::Entity_ID f_above = mesh_surf_->entity_get_parent(AmanziMesh::CELL, col);
-  auto& col_iter = mesh_->cells_of_column(col);
-  ncells_per_col_ = col_iter.size();
-
-  AmanziGeometry::Point surf_centroid = mesh_->face_centroid(f_above);
-  AmanziGeometry::Point neg_z(3);
-  neg_z.set(0., 0., -1);
-
-  for (std::size_t i = 0; i != col_iter.size(); ++i) {
-    // depth centroid
-    (*depth)[i] = surf_centroid[2] - mesh_->cell_centroid(col_iter[i])[2];
-
-    // dz
-    // -- find face_below
-    AmanziMesh::Entity_ID_List faces;
-    std::vector<int> dirs;
-    mesh_->cell_get_faces_and_dirs(col_iter[i], &faces, &dirs);
-
-    // -- mimics implementation of build_columns() in Mesh
-    double mindp = 999.0;
-    AmanziMesh::Entity_ID f_below = -1;
-    for (std::size_t j = 0; j != faces.size(); ++j) {
-      AmanziGeometry::Point normal = mesh_->face_normal(faces[j]);
-      if (dirs[j] == -1) normal *= -1;
-      normal /= AmanziGeometry::norm(normal);
-
-      double dp = -normal * neg_z;
-      if (dp < mindp) {
-        mindp = dp;
-        f_below = faces[j];
-      }
-    }
-
-    // -- fill the val
-    (*dz)[i] = mesh_->face_centroid(f_above)[2] - mesh_->face_centroid(f_below)[2];
-    AMANZI_ASSERT((*dz)[i] > 0.);
-    f_above = f_below;
+  const auto& col_geom = getColumnGeometry(mesh_);
+  ncells_per_col_ = col_geom.num_cells(col);
+  for (int i = 0; i != ncells_per_col_; ++i) {
+    int ci = col_geom.offsets[col] + i;
+    (*depth)[i] = col_geom.depth[ci];
+    (*dz)[i] = col_geom.dz[ci];
   }
 }
 
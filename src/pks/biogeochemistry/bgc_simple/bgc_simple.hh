@@ -48,7 +48,16 @@ that build_columns in the subsurface Mesh_ spec has been supplied.
 
   * `"wind speed reference height [m]`" ``[double]`` **2.0** Reference height of the wind speed dataset.
 
-  * `"cryoturbation mixing coefficient [cm^2/yr]`" ``[double]`` **5.0** Controls diffusion of carbon into the subsurface via cryoturbation.
+  * `"cryoturbation mixing coefficient [cm^2/yr]`" ``[double]`` **5.0** Controls diffusion of carbon into the subsurface via cryoturbation.  Solved implicitly in the unfrozen part of each column, so is stable at any time step.
+
+  * `"biology period [s]`" ``[double]`` **-1** If positive, supercycle the
+    model: each step only accumulates time averages of the met data, soil
+    temperature, and soil pressure, and the vegetation and soil carbon models
+    are run once this period has elapsed, over the whole period, using the
+    averages.  Transpiration and other outputs are held fixed in between.
+    Note that `"initial time step`" still limits the step size, so should be
+    set to allow the coordinator its natural steps.  The partial averages are
+    checkpointed, so a restart resumes the current period.
 
   * `"leaf biomass initial condition`" ``[initial-conditions-spec]`` Sets the leaf biomass IC.
 
@@ -80,6 +89,8 @@ that build_columns in the subsurface Mesh_ spec has been supplied.
 #ifndef PKS_BGC_SIMPLE_HH_
 #define PKS_BGC_SIMPLE_HH_
 
+#include <map>
+
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_RCP.hpp"
 #include "Epetra_SerialDenseVector.h"
@@ -137,6 +148,9 @@ class BGCSimple : public PK_Physical_Default {
                    Teuchos::Ptr<Epetra_SerialDenseVector> depth,
                    Teuchos::Ptr<Epetra_SerialDenseVector> dz);
 
+  bool AccumulateForcing_(double dt);
+  const Epetra_MultiVector& GetForcing_(const Key& key);
+
  protected:
   double dt_;
   Teuchos::RCP<const AmanziMesh::Mesh> mesh_surf_;
@@ -158,6 +172,19 @@ class BGCSimple : public PK_Physical_Default {
   int ncells_per_col_;
   std::string soil_part_name_;
 
+  // flattened column workspace for the implicit cryoturbation solve
+  std::vector<double> cryo_temp_, cryo_som_, cryo_work_;
+
+  // supercycling, with time-integrated forcing.  The last committed
+  // integrals and their time are kept in State, at Tag(name_), so that they
+  // are checkpointed; forcing_avg_ is the working copy.
+  double biology_period_;
+  double forcing_time_;
+  Key forcing_time_key_;
+  std::vector<Key> forcing_keys_;
+  std::map<Key, Key> forcing_integral_keys_;
+  std::map<Key, Teuchos::RCP<Epetra_MultiVector>> forcing_avg_;
+
   // keys
   Key trans_key_;
   Key shaded_sw_key_;
@@ -759,8 +759,11 @@ BGCAdvance(double t,
   }
 
   //================================================
-  //do vertical diffusion
-  Cryoturbate(dt_days, SoilTArr, SoilDArr, SoilThicknessArr, soilcarr, cryoturbation_coef);
+  //do vertical diffusion -- callers that cryoturbate on their own, e.g. with
+  //CryoturbateImplicit(), pass a zero coefficient
+  if (cryoturbation_coef > 0.) {
+    Cryoturbate(dt_days, SoilTArr, SoilDArr, SoilThicknessArr, soilcarr, cryoturbation_coef);
+  }
   return;
 }
 
@@ -842,5 +845,81 @@ Cryoturbate(double dt,
 }
 
 
+// Cryoturbation -- implicit diffusion of the carbon, solved by the Thomas
+// algorithm on the unfrozen part of each column, all pools at once.
+void
+CryoturbateImplicit(double dt,
+                    const std::vector<int>& col_offsets,
+                    const double* SoilTArr,
+                    const double* SoilDArr,
+                    const double* SoilThicknessArr,
+                    int npools,
+                    const std::vector<double>& diffusion_coefs,
+                    double* SOM,
+                    std::vector<double>& work)
+{
+  int ncols = col_offsets.size() - 1;
+  int max_ncells = 0;
+  for (int col = 0; col != ncols; ++col) {
+    max_ncells = std::max(max_ncells, col_offsets[col + 1] - col_offsets[col]);
+  }
+
+  // work holds the modified upper diagonal, cell-major like SOM
+  if (work.size() < (std::size_t)(max_ncells * npools)) work.resize(max_ncells * npools);
+  double* cp = work.data();
+
+  for (int col = 0; col != ncols; ++col) {
+    int off = col_offsets[col];
+    int ncells = col_offsets[col + 1] - off;
+    const double* T = SoilTArr + off;
+    const double* D = SoilDArr + off;
+    const double* dz = SoilThicknessArr + off;
+    double* C = SOM + off * npools;
+
+    // only cryoturbate unfrozen soil, with no flux across the frozen interface
+    int k_frozen = 0;
+    while (k_frozen < ncells && T[k_frozen] > 273.15) k_frozen++;
+    if (k_frozen < 2) continue;
+
+    // forward elimination, where the coefficients of cell k are
+    //   a = -dt*D / (dz_k dz_up),  c = -dt*D / (dz_k dz_dn),  b = 1 - a - c
+    double w_dn = dt / (dz[0] * (D[1] - D[0]));
+    for (int l = 0; l != npools; ++l) {
+      double c = -w_dn * diffusion_coefs[l];
+      double b = 1. - c;
+      cp[l] = c / b;
+      C[l] /= b;
+    }
+
+    for (int k = 1; k != k_frozen; ++k) {
+      double w_up = dt / (dz[k] * (D[k] - D[k - 1]));
+      w_dn = k == k_frozen - 1 ? 0. : dt / (dz[k] * (D[k + 1] - D[k]));
+      double* C_k = C + k * npools;
+      double* cp_k = cp + k * npools;
+      const double* C_up = C_k - npools;
+      const double* cp_up = cp_k - npools;
+
+#pragma omp simd
+      for (int l = 0; l < npools; ++l) {
+        double a = -w_up * diffusion_coefs[l];
+        double c = -w_dn * diffusion_coefs[l];
+        double m = 1. - a - c - a * cp_up[l];
+        cp_k[l] = c / m;
+        C_k[l] = (C_k[l] - a * C_up[l]) / m;
+      }
+    }
+
+    // back substitution
+    for (int k = k_frozen - 2; k >= 0; --k) {
+      double* C_k = C + k * npools;
+      const double* C_dn = C_k + npools;
+      const double* cp_k = cp + k * npools;
+#pragma omp simd
+      for (int l = 0; l < npools; ++l) { C_k[l] -= cp_k[l] * C_dn[l]; }
+    }
+  }
+}
+
+
 } // namespace BGC
 } // namespace Amanzi
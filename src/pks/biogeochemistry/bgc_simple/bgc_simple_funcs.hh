@@ -61,6 +61,23 @@ Cryoturbate(double dt,
             std::vector<Teuchos::RCP<SoilCarbon>>& soilcarr,
             std::vector<double>& diffusion_coefs);
 
+// Implicit (backward Euler) cryoturbation of many columns at once.
+//
+// Column data is flattened: cells of column col are col_offsets[col] to
+// col_offsets[col+1]-1, ordered from the surface down.  SOM is cell-major
+// with the npools pools of each cell contiguous, and is updated in place.
+// work is resized as needed and may be reused across calls.
+void
+CryoturbateImplicit(double dt,
+                    const std::vector<int>& col_offsets,
+                    const double* SoilTArr,
+                    const double* SoilDArr,
+                    const double* SoilThicknessArr,
+                    int npools,
+                    const std::vector<double>& diffusion_coefs,
+                    double* SOM,
+                    std::vector<double>& work);
+
 
 } // namespace BGC
 } // namespace Amanzi
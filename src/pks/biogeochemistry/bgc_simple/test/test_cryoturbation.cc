@@ -0,0 +1,176 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+// Checks the implicit cryoturbation solve against the explicit one, and that
+// it conserves carbon and leaves frozen columns alone.
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "Epetra_SerialDenseVector.h"
+#include "Teuchos_RCP.hpp"
+
+#include "SoilCarbon.hh"
+#include "SoilCarbonParameters.hh"
+#include "bgc_simple_funcs.hh"
+
+using namespace Amanzi::BGC;
+
+namespace {
+
+const int npools = 7;
+
+// Flattened columns, as BGCSimple passes them to CryoturbateImplicit().
+struct Columns {
+  std::vector<int> offsets;
+  std::vector<double> T, depth, dz, SOM;
+
+  // Adds a column of ncells, the top n_unfrozen of which are unfrozen, with
+  // cell thicknesses growing with depth and carbon decaying with depth.
+  void add(int ncells, int n_unfrozen, double dz_top)
+  {
+    if (offsets.empty()) offsets.push_back(0);
+    double z_top = 0.;
+    for (int k = 0; k != ncells; ++k) {
+      double dz_k = dz_top * (1. + 0.2 * k);
+      T.push_back(k < n_unfrozen ? 275. : 270.);
+      dz.push_back(dz_k);
+      depth.push_back(z_top + dz_k / 2.);
+      z_top += dz_k;
+      for (int l = 0; l != npools; ++l) {
+        SOM.push_back((l + 1) * std::exp(-depth.back()) + 0.1 * ((k + l) % 3));
+      }
+    }
+    offsets.push_back(offsets.back() + ncells);
+  }
+
+  // total carbon of pool l in column col
+  double total(int col, int l) const
+  {
+    double sum = 0.;
+    for (int c = offsets[col]; c != offsets[col + 1]; ++c) sum += SOM[c * npools + l] * dz[c];
+    return sum;
+  }
+
+  void cryoturbate(double dt, const std::vector<double>& coefs)
+  {
+    std::vector<double> work;
+    CryoturbateImplicit(
+      dt, offsets, T.data(), depth.data(), dz.data(), npools, coefs, SOM.data(), work);
+  }
+};
+
+std::vector<double>
+diffusionCoefs()
+{
+  std::vector<double> coefs(npools);
+  for (int l = 0; l != npools; ++l) coefs[l] = 1.e-4 * (l + 1);
+  return coefs;
+}
+
+} // namespace
+
+
+SUITE(CRYOTURBATION)
+{
+  // For a small step, backward Euler and forward Euler differ at second
+  // order, much less than the change itself.
+  TEST(SMALL_DT_MATCHES_EXPLICIT)
+  {
+    Columns cols;
+    cols.add(10, 6, 0.05);
+    std::vector<double> SOM_init = cols.SOM;
+
+    auto coefs = diffusionCoefs();
+    double dt = 1.e-4;
+    cols.cryoturbate(dt, coefs);
+
+    // explicit, on SoilCarbon pools
+    int ncells = cols.offsets[1];
+    auto params = Teuchos::rcp(new SoilCarbonParameters(npools, 50.));
+    std::vector<Teuchos::RCP<SoilCarbon>> soilcarr(ncells);
+    Epetra_SerialDenseVector T(ncells), depth(ncells), dz(ncells);
+    for (int c = 0; c != ncells; ++c) {
+      soilcarr[c] = Teuchos::rcp(new SoilCarbon(params));
+      for (int l = 0; l != npools; ++l) soilcarr[c]->SOM[l] = SOM_init[c * npools + l];
+      T[c] = cols.T[c];
+      depth[c] = cols.depth[c];
+      dz[c] = cols.dz[c];
+    }
+    Cryoturbate(dt, T, depth, dz, soilcarr, coefs);
+
+    double max_change = 0., max_diff = 0.;
+    for (int c = 0; c != ncells; ++c) {
+      for (int l = 0; l != npools; ++l) {
+        double expl = soilcarr[c]->SOM[l];
+        max_change = std::max(max_change, std::abs(expl - SOM_init[c * npools + l]));
+        max_diff = std::max(max_diff, std::abs(expl - cols.SOM[c * npools + l]));
+      }
+    }
+    CHECK(max_change > 0.);
+    CHECK(max_diff < 1.e-3 * max_change);
+  }
+
+  // With no flux at the surface or the frozen interface, the total carbon of
+  // each pool is conserved, at any step size.  Frozen cells do not change,
+  // and the solution stays within the initial bounds.
+  TEST(CONSERVES_CARBON)
+  {
+    Columns cols;
+    cols.add(10, 6, 0.05);
+    cols.add(15, 15, 0.02);
+    cols.add(8, 3, 0.1);
+    Columns init = cols;
+
+    cols.cryoturbate(1.e4, diffusionCoefs());
+
+    for (int col = 0; col != 3; ++col) {
+      for (int l = 0; l != npools; ++l) {
+        CHECK_CLOSE(init.total(col, l), cols.total(col, l), 1.e-12 * init.total(col, l));
+      }
+    }
+
+    double min_init = *std::min_element(init.SOM.begin(), init.SOM.end());
+    double max_init = *std::max_element(init.SOM.begin(), init.SOM.end());
+    for (int c = 0; c != (int)cols.T.size(); ++c) {
+      for (int l = 0; l != npools; ++l) {
+        double C = cols.SOM[c * npools + l];
+        if (cols.T[c] < 273.15) CHECK_EQUAL(init.SOM[c * npools + l], C);
+        CHECK(C >= min_init - 1.e-12 && C <= max_init + 1.e-12);
+      }
+    }
+  }
+
+  // Columns with fewer than two unfrozen cells, including empty and one-cell
+  // columns, are left unchanged.
+  TEST(FROZEN_COLUMNS)
+  {
+    Columns cols;
+    cols.add(10, 0, 0.05);
+    cols.add(10, 1, 0.05);
+    cols.add(0, 0, 0.05);
+    cols.add(1, 1, 0.05);
+    cols.add(4, 4, 0.05);
+    Columns init = cols;
+
+    cols.cryoturbate(1., diffusionCoefs());
+
+    int last = cols.offsets[4];
+    for (int i = 0; i != last * npools; ++i) CHECK_EQUAL(init.SOM[i], cols.SOM[i]);
+
+    // the last, unfrozen column does mix
+    bool changed = false;
+    for (int i = last * npools; i != (int)cols.SOM.size(); ++i) {
+      changed |= init.SOM[i] != cols.SOM[i];
+    }
+    CHECK(changed);
+  }
+}
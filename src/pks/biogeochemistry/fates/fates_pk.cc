@@ -18,6 +18,7 @@
  * ------------------------------------------------------------------------- */
 
 
+#include "column_geometry.hh"
 #include "fates_pk.hh"
 #include "bgc_simple.hh"
 #include "vegetation.hh"
@@ -406,73 +407,60 @@ FATES_PK::AdvanceStep(double t_old, double t_new, bool reinit)
 
 
   if (run_photo) {
-    for (unsigned int c = 0; c < ncells_owned_; ++c) {
-      if (surface_only_) {
+    // pack all columns in one pass per field
+    if (surface_only_) {
+      for (unsigned int c = 0; c < ncells_owned_; ++c) {
         t_soil_[c] = air_temp[0][c];
         poro_[c] = 0.5;
         eff_poro_[c] = poro_[c];
         vsm_[c] = 1. * poro_[c];
         suc_[c] = 0.;
+      }
+    } else {
+      if (S_next_->HasField(soil_temp_key_)) {
+        S_next_->GetEvaluator(soil_temp_key_)->HasFieldChanged(S_next_.ptr(), name_);
+        const Epetra_Vector& temp_vec =
+          *(*S_next_->Get<CompositeVector>(soil_temp_key_).ViewComponent("cell", false))(0);
+        FieldToColumns_(temp_vec, t_soil_.data());
+      }
+
+      if (S_next_->HasField(poro_key_)) {
+        S_next_->GetEvaluator(poro_key_)->HasFieldChanged(S_next_.ptr(), name_);
+        const Epetra_Vector& poro_vec =
+          *(*S_next_->Get<CompositeVector>(poro_key_).ViewComponent("cell", false))(0);
+        FieldToColumns_(poro_vec, poro_.data());
+      }
+      eff_poro_.assign(poro_.begin(), poro_.end());
+
+      if (S_next_->HasField(sat_key_)) {
+        S_next_->GetEvaluator(sat_key_)->HasFieldChanged(S_next_.ptr(), name_);
+        const Epetra_Vector& sat_vec =
+          *(*S_next_->Get<CompositeVector>(sat_key_).ViewComponent("cell", false))(0);
+        FieldToColumns_(sat_vec, vsm_.data());
       } else {
-        if (S_next_->HasField(soil_temp_key_)) {
-          S_next_->GetEvaluator(soil_temp_key_)->HasFieldChanged(S_next_.ptr(), name_);
-          const Epetra_Vector& temp_vec =
-            *(*S_next_->Get<CompositeVector>(soil_temp_key_).ViewComponent("cell", false))(0);
-          FieldToColumn_(c, temp_vec, t_soil_.data() + c * ncells_per_col_, ncells_per_col_);
-        }
-
-
-        if (S_next_->HasField(poro_key_)) {
-          S_next_->GetEvaluator(poro_key_)->HasFieldChanged(S_next_.ptr(), name_);
-          const Epetra_Vector& poro_vec =
-            *(*S_next_->Get<CompositeVector>(poro_key_).ViewComponent("cell", false))(0);
-          FieldToColumn_(c, poro_vec, poro_.data() + c * ncells_per_col_, ncells_per_col_);
-        }
-        eff_poro_.assign(poro_.begin(), poro_.end());
-
-        if (S_next_->HasField(sat_key_)) {
-          S_next_->GetEvaluator(sat_key_)->HasFieldChanged(S_next_.ptr(), name_);
-          const Epetra_Vector& sat_vec =
-            *(*S_next_->Get<CompositeVector>(sat_key_).ViewComponent("cell", false))(0);
-          FieldToColumn_(c, sat_vec, vsm_.data() + c * ncells_per_col_, ncells_per_col_);
-
-        } else {
-          vsm_.assign(poro_.begin(),
-                      poro_.end()); // No saturation in state. Fully saturated assumption;
-        }
-
-        if (S_next_->HasField(suc_key_)) {
-          S_next_->GetEvaluator(suc_key_)->HasFieldChanged(S_next_.ptr(), name_);
-          const Epetra_Vector& suc_vec =
-            *(*S_next_->Get<CompositeVector>(suc_key_).ViewComponent("cell", false))(0);
-          FieldToColumn_(c, suc_vec, suc_.data() + c * ncells_per_col_, ncells_per_col_);
-
-        } else {
-          for (int i = 0; i < suc_.size(); i++) suc_[i] = 0.; // No suction is defined in State;
-        }
+        vsm_.assign(poro_.begin(),
+                    poro_.end()); // No saturation in state. Fully saturated assumption;
       }
-    }
 
+      if (S_next_->HasField(suc_key_)) {
+        S_next_->GetEvaluator(suc_key_)->HasFieldChanged(S_next_.ptr(), name_);
+        const Epetra_Vector& suc_vec =
+          *(*S_next_->Get<CompositeVector>(suc_key_).ViewComponent("cell", false))(0);
+        FieldToColumns_(suc_vec, suc_.data());
+      } else {
+        suc_.assign(suc_.size(), 0.); // No suction is defined in State;
+      }
+    }
 
-    // if (S_next_->cycle() == 1102){
-    //   std::cout<<"Reached cycle 1102\n";
-    // }
-
-    std::cout << "t_soil_\n";
-    for (auto ent : t_soil_) std::cout << ent << " ";
-    std::cout << "\n";
-    std::cout << "poro\n";
-    for (auto ent : poro_) std::cout << ent << " ";
-    std::cout << "\n";
-    std::cout << "eff_poro_\n";
-    for (auto ent : eff_poro_) std::cout << ent << " ";
-    std::cout << "\n";
-    std::cout << "vsm_\n";
-    for (auto ent : vsm_) std::cout << ent << " ";
-    std::cout << "\n";
-    std::cout << "suc_\n";
-    for (auto ent : suc_) std::cout << ent << " ";
-    std::cout << "\n";
+    if (vo_->os_OK(Teuchos::VERB_EXTREME)) {
+      std::vector<std::string> names{ "t_soil_", "poro", "eff_poro_", "vsm_", "suc_" };
+      std::vector<const std::vector<double>*> vals{ &t_soil_, &poro_, &eff_poro_, &vsm_, &suc_ };
+      for (int k = 0; k != names.size(); ++k) {
+        *vo_->os() << names[k] << std::endl;
+        for (auto ent : *vals[k]) *vo_->os() << ent << " ";
+        *vo_->os() << std::endl;
+      }
+    }
 
     int array_size = t_soil_.size();
     wrap_btran(
@@ -617,50 +605,27 @@ FATES_PK::FieldToColumn_(AmanziMesh::Entity_ID col,
   for (std::size_t i = 0; i != col_iter.size(); ++i) { col_vec[i] = vec[col_iter[i]]; }
 }
 
+// helper function for pushing a field to all columns at once, site-major
+void
+FATES_PK::FieldToColumns_(const Epetra_Vector& vec, double* site_major)
+{
+  const auto& col_cells = getColumnGeometry(mesh_).cells;
+  int n = col_cells.size();
+  for (int i = 0; i != n; ++i) { site_major[i] = vec[col_cells[i]]; }
+}
+
 // helper function for collecting column dz and depth
 void
 FATES_PK::ColDepthDz_(AmanziMesh::Entity_ID col,
                       Teuchos::Ptr<Epetra_SerialDenseVector> depth,
                       Teuchos::Ptr<Epetra_SerialDenseVector> dz)
 {
-  AmanziMesh::Entity_ID f_above = mesh_surf_->entity_get_parent(AmanziMesh::CELL, col);
-
-  auto& col_iter = mesh_->cells_of_column(col);
-  ncells_per_col_ = col_iter.size();
-
-  AmanziGeometry::Point surf_centroid = mesh_->face_centroid(f_above);
-  AmanziGeometry::Point neg_z(3);
-  neg_z.set(0., 0., -1);
-
-  for (std::size_t i = 0; i != col_iter.size(); ++i) {
-    // depth centroid
-    (*depth)[i] = surf_centroid[2] - mesh_->cell_centroid(col_iter[i])[2];
-
-    // dz
-    // -- find face_below
-    AmanziMesh::Entity_ID_List faces;
-    std::vector<int> dirs;
-    mesh_->cell_get_faces_and_dirs(col_iter[i], &faces, &dirs);
-
-    // -- mimics implementation of build_columns() in Mesh
-    double mindp = 999.0;
-    AmanziMesh::Entity_ID f_below = -1;
-    for (std::size_t j = 0; j != faces.size(); ++j) {
-      AmanziGeometry::Point normal = mesh_->face_normal(faces[j]);
-      if (dirs[j] == -1) normal *= -1;
-      normal /= AmanziGeometry::norm(normal);
-
-      double dp = -normal * neg_z;
-      if (dp < mindp) {
-        mindp = dp;
-        f_below = faces[j];
-      }
-    }
-
-    // -- fill the val
-    (*dz)[i] = mesh_->face_centroid(f_above)[2] - mesh_->face_centroid(f_below)[2];
-    AMANZI_ASSERT((*dz)[i] > 0.);
-    f_above = f_below;
+  const auto& col_geom = getColumnGeometry(mesh_);
+  ncells_per_col_ = col_geom.num_cells(col);
+  for (int i = 0; i != ncells_per_col_; ++i) {
+    int ci = col_geom.offsets[col] + i;
+    (*depth)[i] = col_geom.depth[ci];
+    (*dz)[i] = col_geom.dz[ci];
   }
 }
 
@@ -121,6 +121,7 @@ class FATES_PK : public PK_Physical_Default {
  protected:
   void
   FieldToColumn_(AmanziMesh::Entity_ID col, const Epetra_Vector& vec, double* col_vec, int ncol);
+  void FieldToColumns_(const Epetra_Vector& vec, double* site_major);
   void ColDepthDz_(AmanziMesh::Entity_ID col,
                    Teuchos::Ptr<Epetra_SerialDenseVector> depth,
                    Teuchos::Ptr<Epetra_SerialDenseVector> dz);
@@ -12,6 +12,7 @@
 //! Subsidence through bulk ice loss and cell volumetric change.
 #include "CompositeVectorFunctionFactory.hh"
 #include "pk_helpers.hh"
+#include "column_geometry.hh"
 #include "volumetric_deformation.hh"
 
 #define DEBUG 0
@@ -524,6 +525,7 @@ VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
 
       mesh_nc_->deform(target_cell_vols, min_cell_vols, below_node_list, true);
       deformed_this_step_ = true;
+      invalidateColumnGeometry(*mesh_);
       break;
     }
 
@@ -533,12 +535,12 @@ VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
         *S_->Get<CompositeVector>(cv_key_, tag_current_).ViewComponent("cell");
 
       CompositeVector& nodal_dz_vec = S_->GetW<CompositeVector>(nodal_dz_key_, tag_next_, name_);
+      int ncols = mesh_->num_columns(false);
+      const auto& col_geom = getColumnGeometry(mesh_);
       { // context for vector prior to communication
         Epetra_MultiVector& nodal_dz = *nodal_dz_vec.ViewComponent("node", "true");
         nodal_dz.PutScalar(0.);
 
-        int ncols = mesh_->num_columns(false);
-        int z_index = mesh_->space_dimension() - 1;
         for (int col = 0; col != ncols; ++col) {
           auto& col_cells = mesh_->cells_of_column(col);
           auto& col_faces = mesh_->faces_of_column(col);
@@ -547,11 +549,9 @@ VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
           // iterate up the column accumulating face displacements
           double face_displacement = 0.;
           for (int ci = col_cells.size() - 1; ci >= 0; --ci) {
-            int f_below = col_faces[ci + 1];
             int f_above = col_faces[ci];
 
-            double dz =
-              mesh_->face_centroid(f_above)[z_index] - mesh_->face_centroid(f_below)[z_index];
+            double dz = col_geom.dz[col_geom.offsets[col] + ci];
             face_displacement += -dz * dcell_vol_c[0][col_cells[ci]] / cv[0][col_cells[ci]];
 
             AMANZI_ASSERT(face_displacement >= 0.);
@@ -588,20 +588,41 @@ VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
         }
       }
 
-      // deform the mesh
-      Entity_ID_List node_ids(nodal_dz.MyLength());
-      AmanziGeometry::Point_List new_positions(nodal_dz.MyLength());
+      // deform the mesh, moving only the nodes that are displaced
+      Entity_ID_List node_ids;
+      AmanziGeometry::Point_List new_positions;
       for (int n = 0; n != nodal_dz.MyLength(); ++n) {
-        node_ids[n] = n;
-        mesh_->node_get_coordinates(n, &new_positions[n]);
         AMANZI_ASSERT(nodal_dz[0][n] >= 0.);
-        new_positions[n][2] -= nodal_dz[0][n];
+        if (nodal_dz[0][n] > 0.) {
+          AmanziGeometry::Point nc;
+          mesh_->node_get_coordinates(n, &nc);
+          nc[2] -= nodal_dz[0][n];
+          node_ids.emplace_back(n);
+          new_positions.emplace_back(nc);
+        }
+      }
+
+      // Displacement accumulates upward and is averaged over the columns
+      // sharing a node, so a column moves iff a node of its top face does.
+      std::vector<int> moved_cols;
+      Entity_ID_List nodes;
+      for (int col = 0; col != ncols; ++col) {
+        mesh_->face_get_nodes(col_geom.top_faces[col], &nodes);
+        for (auto n : nodes) {
+          if (nodal_dz[0][n] > 0.) {
+            moved_cols.emplace_back(col);
+            break;
+          }
+        }
       }
 
       AmanziGeometry::Point_List final_positions;
       for (auto& p : new_positions) { AMANZI_ASSERT(AmanziGeometry::norm(p) >= 0.); }
       mesh_nc_->deform(node_ids, new_positions, true, &final_positions);
       deformed_this_step_ = true;
+
+      // vertical only, so only the moved columns' geometry changes
+      updateColumnGeometry(mesh_, moved_cols);
       // INSERT EXTRA CODE TO UNDEFORM THE MESH FOR MIN_VOLS!
       break;
     }
@@ -627,6 +648,11 @@ VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
         AmanziGeometry::Point coord_domain(dim);
         mesh_->node_get_coordinates(pnode, &coord_domain);
 
+        // only pass the nodes that moved
+        AmanziGeometry::Point coord_surf(dim);
+        surf3d_mesh_->node_get_coordinates(i, &coord_surf);
+        if (coord_surf[dim - 1] == coord_domain[dim - 1]) continue;
+
         surface_nodeids.push_back(i);
         surface_newpos.push_back(coord_domain);
       }
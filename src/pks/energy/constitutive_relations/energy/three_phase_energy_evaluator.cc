@@ -13,6 +13,8 @@ Energy for a three-phase, gas+liquid+ice evaluator.
   Generated via evaluator_generator.
 */
 
+#include <array>
+
 #include "three_phase_energy_evaluator.hh"
 #include "three_phase_energy_model.hh"
 
@@ -22,7 +24,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 ThreePhaseEnergyEvaluator::ThreePhaseEnergyEvaluator(Teuchos::ParameterList& plist)
-  : EvaluatorSecondaryMonotypeCV(plist)
+  : EvaluatorSecondaryMonotypeCV(plist), partials_valid_(false)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("three_phase_energy parameters");
   model_ = Teuchos::rcp(new ThreePhaseEnergyModel(sublist));
@@ -30,6 +32,28 @@ ThreePhaseEnergyEvaluator::ThreePhaseEnergyEvaluator(Teuchos::ParameterList& pli
 }
 
 
+// Copy constructor, which does not share the cached partials
+ThreePhaseEnergyEvaluator::ThreePhaseEnergyEvaluator(const ThreePhaseEnergyEvaluator& other)
+  : EvaluatorSecondaryMonotypeCV(other),
+    phi_key_(other.phi_key_),
+    phi0_key_(other.phi0_key_),
+    sl_key_(other.sl_key_),
+    nl_key_(other.nl_key_),
+    ul_key_(other.ul_key_),
+    si_key_(other.si_key_),
+    ni_key_(other.ni_key_),
+    ui_key_(other.ui_key_),
+    sg_key_(other.sg_key_),
+    ng_key_(other.ng_key_),
+    ug_key_(other.ug_key_),
+    rho_r_key_(other.rho_r_key_),
+    ur_key_(other.ur_key_),
+    cv_key_(other.cv_key_),
+    model_(other.model_),
+    partials_valid_(false)
+{}
+
+
 // Virtual copy constructor
 Teuchos::RCP<Evaluator>
 ThreePhaseEnergyEvaluator::Clone() const
@@ -109,6 +133,9 @@ ThreePhaseEnergyEvaluator::InitializeFromPlist_()
 void
 ThreePhaseEnergyEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  // the dependencies changed, so the cached partials are stale
+  partials_valid_ = false;
+
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> phi = S.GetPtr<CompositeVector>(phi_key_, tag);
   Teuchos::RCP<const CompositeVector> phi0 = S.GetPtr<CompositeVector>(phi0_key_, tag);
@@ -143,22 +170,22 @@ ThreePhaseEnergyEvaluator::Evaluate_(const State& S, const std::vector<Composite
     Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
     int ncomp = result[0]->size(*comp, false);
-    for (int i = 0; i != ncomp; ++i) {
-      result_v[0][i] = model_->Energy(phi_v[0][i],
-                                      phi0_v[0][i],
-                                      sl_v[0][i],
-                                      nl_v[0][i],
-                                      ul_v[0][i],
-                                      si_v[0][i],
-                                      ni_v[0][i],
-                                      ui_v[0][i],
-                                      sg_v[0][i],
-                                      ng_v[0][i],
-                                      ug_v[0][i],
-                                      rho_r_v[0][i],
-                                      ur_v[0][i],
-                                      cv_v[0][i]);
-    }
+    model_->Energy(ncomp,
+                   phi_v[0],
+                   phi0_v[0],
+                   sl_v[0],
+                   nl_v[0],
+                   ul_v[0],
+                   si_v[0],
+                   ni_v[0],
+                   ui_v[0],
+                   sg_v[0],
+                   ng_v[0],
+                   ug_v[0],
+                   rho_r_v[0],
+                   ur_v[0],
+                   cv_v[0],
+                   result_v[0]);
   }
 }
 
@@ -185,463 +212,25 @@ ThreePhaseEnergyEvaluator::EvaluatePartialDerivative_(const State& S,
   Teuchos::RCP<const CompositeVector> ur = S.GetPtr<CompositeVector>(ur_key_, tag);
   Teuchos::RCP<const CompositeVector> cv = S.GetPtr<CompositeVector>(cv_key_, tag);
 
-  if (wrt_key == phi_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDPorosity(phi_v[0][i],
-                                                  phi0_v[0][i],
-                                                  sl_v[0][i],
-                                                  nl_v[0][i],
-                                                  ul_v[0][i],
-                                                  si_v[0][i],
-                                                  ni_v[0][i],
-                                                  ui_v[0][i],
-                                                  sg_v[0][i],
-                                                  ng_v[0][i],
-                                                  ug_v[0][i],
-                                                  rho_r_v[0][i],
-                                                  ur_v[0][i],
-                                                  cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == phi0_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDBasePorosity(phi_v[0][i],
-                                                      phi0_v[0][i],
-                                                      sl_v[0][i],
-                                                      nl_v[0][i],
-                                                      ul_v[0][i],
-                                                      si_v[0][i],
-                                                      ni_v[0][i],
-                                                      ui_v[0][i],
-                                                      sg_v[0][i],
-                                                      ng_v[0][i],
-                                                      ug_v[0][i],
-                                                      rho_r_v[0][i],
-                                                      ur_v[0][i],
-                                                      cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == sl_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDSaturationLiquid(phi_v[0][i],
-                                                          phi0_v[0][i],
-                                                          sl_v[0][i],
-                                                          nl_v[0][i],
-                                                          ul_v[0][i],
-                                                          si_v[0][i],
-                                                          ni_v[0][i],
-                                                          ui_v[0][i],
-                                                          sg_v[0][i],
-                                                          ng_v[0][i],
-                                                          ug_v[0][i],
-                                                          rho_r_v[0][i],
-                                                          ur_v[0][i],
-                                                          cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == nl_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityLiquid(phi_v[0][i],
-                                                            phi0_v[0][i],
-                                                            sl_v[0][i],
-                                                            nl_v[0][i],
-                                                            ul_v[0][i],
-                                                            si_v[0][i],
-                                                            ni_v[0][i],
-                                                            ui_v[0][i],
-                                                            sg_v[0][i],
-                                                            ng_v[0][i],
-                                                            ug_v[0][i],
-                                                            rho_r_v[0][i],
-                                                            ur_v[0][i],
-                                                            cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == ul_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyLiquid(phi_v[0][i],
-                                                              phi0_v[0][i],
-                                                              sl_v[0][i],
-                                                              nl_v[0][i],
-                                                              ul_v[0][i],
-                                                              si_v[0][i],
-                                                              ni_v[0][i],
-                                                              ui_v[0][i],
-                                                              sg_v[0][i],
-                                                              ng_v[0][i],
-                                                              ug_v[0][i],
-                                                              rho_r_v[0][i],
-                                                              ur_v[0][i],
-                                                              cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == si_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDSaturationIce(phi_v[0][i],
-                                                       phi0_v[0][i],
-                                                       sl_v[0][i],
-                                                       nl_v[0][i],
-                                                       ul_v[0][i],
-                                                       si_v[0][i],
-                                                       ni_v[0][i],
-                                                       ui_v[0][i],
-                                                       sg_v[0][i],
-                                                       ng_v[0][i],
-                                                       ug_v[0][i],
-                                                       rho_r_v[0][i],
-                                                       ur_v[0][i],
-                                                       cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == ni_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityIce(phi_v[0][i],
-                                                         phi0_v[0][i],
-                                                         sl_v[0][i],
-                                                         nl_v[0][i],
-                                                         ul_v[0][i],
-                                                         si_v[0][i],
-                                                         ni_v[0][i],
-                                                         ui_v[0][i],
-                                                         sg_v[0][i],
-                                                         ng_v[0][i],
-                                                         ug_v[0][i],
-                                                         rho_r_v[0][i],
-                                                         ur_v[0][i],
-                                                         cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == ui_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyIce(phi_v[0][i],
-                                                           phi0_v[0][i],
-                                                           sl_v[0][i],
-                                                           nl_v[0][i],
-                                                           ul_v[0][i],
-                                                           si_v[0][i],
-                                                           ni_v[0][i],
-                                                           ui_v[0][i],
-                                                           sg_v[0][i],
-                                                           ng_v[0][i],
-                                                           ug_v[0][i],
-                                                           rho_r_v[0][i],
-                                                           ur_v[0][i],
-                                                           cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == sg_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDSaturationGas(phi_v[0][i],
-                                                       phi0_v[0][i],
-                                                       sl_v[0][i],
-                                                       nl_v[0][i],
-                                                       ul_v[0][i],
-                                                       si_v[0][i],
-                                                       ni_v[0][i],
-                                                       ui_v[0][i],
-                                                       sg_v[0][i],
-                                                       ng_v[0][i],
-                                                       ug_v[0][i],
-                                                       rho_r_v[0][i],
-                                                       ur_v[0][i],
-                                                       cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == ng_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityGas(phi_v[0][i],
-                                                         phi0_v[0][i],
-                                                         sl_v[0][i],
-                                                         nl_v[0][i],
-                                                         ul_v[0][i],
-                                                         si_v[0][i],
-                                                         ni_v[0][i],
-                                                         ui_v[0][i],
-                                                         sg_v[0][i],
-                                                         ng_v[0][i],
-                                                         ug_v[0][i],
-                                                         rho_r_v[0][i],
-                                                         ur_v[0][i],
-                                                         cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == ug_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyGas(phi_v[0][i],
-                                                           phi0_v[0][i],
-                                                           sl_v[0][i],
-                                                           nl_v[0][i],
-                                                           ul_v[0][i],
-                                                           si_v[0][i],
-                                                           ni_v[0][i],
-                                                           ui_v[0][i],
-                                                           sg_v[0][i],
-                                                           ng_v[0][i],
-                                                           ug_v[0][i],
-                                                           rho_r_v[0][i],
-                                                           ur_v[0][i],
-                                                           cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == rho_r_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDDensityRock(phi_v[0][i],
-                                                     phi0_v[0][i],
-                                                     sl_v[0][i],
-                                                     nl_v[0][i],
-                                                     ul_v[0][i],
-                                                     si_v[0][i],
-                                                     ni_v[0][i],
-                                                     ui_v[0][i],
-                                                     sg_v[0][i],
-                                                     ng_v[0][i],
-                                                     ug_v[0][i],
-                                                     rho_r_v[0][i],
-                                                     ur_v[0][i],
-                                                     cv_v[0][i]);
-      }
-    }
+  const std::array<const Key*, 14> wrt_keys = {
+    &phi_key_, &phi0_key_, &sl_key_, &nl_key_, &ul_key_, &si_key_, &ni_key_, &ui_key_, &sg_key_,
+    &ng_key_, &ug_key_, &rho_r_key_, &ur_key_, &cv_key_
+  };
+  std::size_t k = 0;
+  while (k != wrt_keys.size() && *wrt_keys[k] != wrt_key) ++k;
+  AMANZI_ASSERT(k != wrt_keys.size());
+
+  // The DAG requests one partial at a time, but they share subexpressions, so
+  // every partial requested so far is computed in a single pass on the first
+  // request after Evaluate_() and then served from partials_.  Partials that
+  // are never requested are neither allocated nor computed.
+  if (partials_.size() != wrt_keys.size()) partials_.resize(wrt_keys.size());
+  if (partials_[k] == Teuchos::null) {
+    partials_[k] = Teuchos::rcp(new CompositeVector(result[0]->Map()));
+    partials_valid_ = false;
+  }
 
-  } else if (wrt_key == ur_key_) {
+  if (!partials_valid_) {
     for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
          ++comp) {
       const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
@@ -658,68 +247,50 @@ ThreePhaseEnergyEvaluator::EvaluatePartialDerivative_(const State& S,
       const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
       const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
       const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyRock(phi_v[0][i],
-                                                            phi0_v[0][i],
-                                                            sl_v[0][i],
-                                                            nl_v[0][i],
-                                                            ul_v[0][i],
-                                                            si_v[0][i],
-                                                            ni_v[0][i],
-                                                            ui_v[0][i],
-                                                            sg_v[0][i],
-                                                            ng_v[0][i],
-                                                            ug_v[0][i],
-                                                            rho_r_v[0][i],
-                                                            ur_v[0][i],
-                                                            cv_v[0][i]);
+      std::array<Epetra_MultiVector*, 14> d_v;
+      for (std::size_t j = 0; j != d_v.size(); ++j) {
+        d_v[j] =
+          partials_[j] == Teuchos::null ? nullptr : partials_[j]->ViewComponent(*comp, false).get();
       }
-    }
-
-  } else if (wrt_key == cv_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
+      std::array<double*, 14> d;
 
       int ncomp = result[0]->size(*comp, false);
       for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDCellVolume(phi_v[0][i],
-                                                    phi0_v[0][i],
-                                                    sl_v[0][i],
-                                                    nl_v[0][i],
-                                                    ul_v[0][i],
-                                                    si_v[0][i],
-                                                    ni_v[0][i],
-                                                    ui_v[0][i],
-                                                    sg_v[0][i],
-                                                    ng_v[0][i],
-                                                    ug_v[0][i],
-                                                    rho_r_v[0][i],
-                                                    ur_v[0][i],
-                                                    cv_v[0][i]);
+        for (std::size_t j = 0; j != d.size(); ++j) d[j] = d_v[j] ? &(*d_v[j])[0][i] : nullptr;
+        model_->EnergyAndDerivatives(phi_v[0][i],
+                                     phi0_v[0][i],
+                                     sl_v[0][i],
+                                     nl_v[0][i],
+                                     ul_v[0][i],
+                                     si_v[0][i],
+                                     ni_v[0][i],
+                                     ui_v[0][i],
+                                     sg_v[0][i],
+                                     ng_v[0][i],
+                                     ug_v[0][i],
+                                     rho_r_v[0][i],
+                                     ur_v[0][i],
+                                     cv_v[0][i],
+                                     d[0],
+                                     d[1],
+                                     d[2],
+                                     d[3],
+                                     d[4],
+                                     d[5],
+                                     d[6],
+                                     d[7],
+                                     d[8],
+                                     d[9],
+                                     d[10],
+                                     d[11],
+                                     d[12],
+                                     d[13]);
       }
     }
-
-  } else {
-    AMANZI_ASSERT(0);
+    partials_valid_ = true;
   }
+
+  *result[0] = *partials_[k];
 }
 
 
@@ -60,7 +60,7 @@ class ThreePhaseEnergyModel;
 class ThreePhaseEnergyEvaluator : public EvaluatorSecondaryMonotypeCV {
  public:
   explicit ThreePhaseEnergyEvaluator(Teuchos::ParameterList& plist);
-  ThreePhaseEnergyEvaluator(const ThreePhaseEnergyEvaluator& other) = default;
+  ThreePhaseEnergyEvaluator(const ThreePhaseEnergyEvaluator& other);
 
   virtual Teuchos::RCP<Evaluator> Clone() const override;
 
@@ -93,6 +93,12 @@ class ThreePhaseEnergyEvaluator : public EvaluatorSecondaryMonotypeCV {
 
   Teuchos::RCP<ThreePhaseEnergyModel> model_;
 
+  // partial derivatives with respect to each dependency, in the order above,
+  // null until first requested, and recomputed together on the first
+  // request after the value is updated
+  std::vector<Teuchos::RCP<CompositeVector>> partials_;
+  bool partials_valid_;
+
  private:
   static Utils::RegisteredFactory<Evaluator, ThreePhaseEnergyEvaluator> reg_;
 };
@@ -53,7 +53,67 @@ ThreePhaseEnergyModel::Energy(double phi,
                               double ur,
                               double cv) const
 {
-  return cv * (phi * (ng * sg * ug + ni * si * ui + nl * sl * ul) + rho_r * ur * (-phi0 + 1));
+  return cv * (phi * (ng * sg * ug + ni * si * ui + nl * sl * ul) + rho_r * ur * (1 - phi0));
+}
+
+// value and all partials in one pass
+double
+ThreePhaseEnergyModel::EnergyAndDerivatives(double phi,
+                                            double phi0,
+                                            double sl,
+                                            double nl,
+                                            double ul,
+                                            double si,
+                                            double ni,
+                                            double ui,
+                                            double sg,
+                                            double ng,
+                                            double ug,
+                                            double rho_r,
+                                            double ur,
+                                            double cv,
+                                            double* d_phi,
+                                            double* d_phi0,
+                                            double* d_sl,
+                                            double* d_nl,
+                                            double* d_ul,
+                                            double* d_si,
+                                            double* d_ni,
+                                            double* d_ui,
+                                            double* d_sg,
+                                            double* d_ng,
+                                            double* d_ug,
+                                            double* d_rho_r,
+                                            double* d_ur,
+                                            double* d_cv) const
+{
+  double x0 = 1 - phi0;
+  double x1 = rho_r * ur;
+  double x2 = ng * ug;
+  double x3 = ni * ui;
+  double x4 = nl * ul;
+  double x5 = sg * x2 + si * x3 + sl * x4;
+  double x6 = phi * x5 + x0 * x1;
+  double x7 = cv * phi;
+  double x8 = sl * x7;
+  double x9 = si * x7;
+  double x10 = sg * x7;
+  double x11 = cv * x0;
+  if (d_phi) *d_phi = cv * x5;
+  if (d_phi0) *d_phi0 = -cv * x1;
+  if (d_sl) *d_sl = x4 * x7;
+  if (d_nl) *d_nl = ul * x8;
+  if (d_ul) *d_ul = nl * x8;
+  if (d_si) *d_si = x3 * x7;
+  if (d_ni) *d_ni = ui * x9;
+  if (d_ui) *d_ui = ni * x9;
+  if (d_sg) *d_sg = x2 * x7;
+  if (d_ng) *d_ng = ug * x10;
+  if (d_ug) *d_ug = ng * x10;
+  if (d_rho_r) *d_rho_r = ur * x11;
+  if (d_ur) *d_ur = rho_r * x11;
+  if (d_cv) *d_cv = x6;
+  return cv * x6;
 }
 
 double
@@ -281,7 +341,7 @@ ThreePhaseEnergyModel::DEnergyDDensityRock(double phi,
                                            double ur,
                                            double cv) const
 {
-  return cv * ur * (-phi0 + 1);
+  return cv * ur * (1 - phi0);
 }
 
 double
@@ -300,7 +360,7 @@ ThreePhaseEnergyModel::DEnergyDInternalEnergyRock(double phi,
                                                   double ur,
                                                   double cv) const
 {
-  return cv * rho_r * (-phi0 + 1);
+  return cv * rho_r * (1 - phi0);
 }
 
 double
@@ -319,7 +379,7 @@ ThreePhaseEnergyModel::DEnergyDCellVolume(double phi,
                                           double ur,
                                           double cv) const
 {
-  return phi * (ng * sg * ug + ni * si * ui + nl * sl * ul) + rho_r * ur * (-phi0 + 1);
+  return phi * (ng * sg * ug + ni * si * ui + nl * sl * ul) + rho_r * ur * (1 - phi0);
 }
 
 } // namespace Relations
@@ -41,6 +41,63 @@ class ThreePhaseEnergyModel {
                 double ur,
                 double cv) const;
 
+  // Array kernel over n contiguous cells, inline to allow vectorization.
+  void Energy(int n,
+              const double* __restrict__ phi,
+              const double* __restrict__ phi0,
+              const double* __restrict__ sl,
+              const double* __restrict__ nl,
+              const double* __restrict__ ul,
+              const double* __restrict__ si,
+              const double* __restrict__ ni,
+              const double* __restrict__ ui,
+              const double* __restrict__ sg,
+              const double* __restrict__ ng,
+              const double* __restrict__ ug,
+              const double* __restrict__ rho_r,
+              const double* __restrict__ ur,
+              const double* __restrict__ cv,
+              double* __restrict__ result) const
+  {
+#pragma omp simd
+    for (int i = 0; i < n; ++i) {
+      result[i] = cv[i] * (phi[i] * (ng[i] * sg[i] * ug[i] + ni[i] * si[i] * ui[i] +
+                                     nl[i] * sl[i] * ul[i]) +
+                           rho_r[i] * ur[i] * (1 - phi0[i]));
+    }
+  }
+
+  // Computes the value and, for each non-null pointer, the partial derivative
+  // with respect to that dependency, sharing common subexpressions.
+  double EnergyAndDerivatives(double phi,
+                              double phi0,
+                              double sl,
+                              double nl,
+                              double ul,
+                              double si,
+                              double ni,
+                              double ui,
+                              double sg,
+                              double ng,
+                              double ug,
+                              double rho_r,
+                              double ur,
+                              double cv,
+                              double* d_phi,
+                              double* d_phi0,
+                              double* d_sl,
+                              double* d_nl,
+                              double* d_ul,
+                              double* d_si,
+                              double* d_ni,
+                              double* d_ui,
+                              double* d_sg,
+                              double* d_ng,
+                              double* d_ug,
+                              double* d_rho_r,
+                              double* d_ur,
+                              double* d_cv) const;
+
   double DEnergyDPorosity(double phi,
                           double phi0,
                           double sl,
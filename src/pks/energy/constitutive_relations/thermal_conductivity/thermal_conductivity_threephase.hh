@@ -55,6 +55,43 @@ class ThermalConductivityThreePhase {
     AMANZI_ASSERT(false);
     return 0.;
   }
+
+  // Returns the thermal conductivity, and computes into each non-null
+  // pointer the corresponding partial derivative, in one call.  Models may
+  // override this to share work across the value and derivatives.
+  virtual double ThermalConductivityAndDerivatives(double porosity,
+                                                   double sat_liq,
+                                                   double sat_ice,
+                                                   double temp,
+                                                   double* dporosity,
+                                                   double* dsat_liq,
+                                                   double* dsat_ice,
+                                                   double* dtemp)
+  {
+    if (dporosity)
+      *dporosity = DThermalConductivity_DPorosity(porosity, sat_liq, sat_ice, temp);
+    if (dsat_liq)
+      *dsat_liq = DThermalConductivity_DSaturationLiquid(porosity, sat_liq, sat_ice, temp);
+    if (dsat_ice) *dsat_ice = DThermalConductivity_DSaturationIce(porosity, sat_liq, sat_ice, temp);
+    if (dtemp) *dtemp = DThermalConductivity_DTemperature(porosity, sat_liq, sat_ice, temp);
+    return ThermalConductivity(porosity, sat_liq, sat_ice, temp);
+  }
+
+  // As above, for local cell c.  Models may override this to cache terms
+  // that depend only on slowly varying inputs, such as porosity, per cell.
+  virtual double CellThermalConductivityAndDerivatives(int c,
+                                                       double porosity,
+                                                       double sat_liq,
+                                                       double sat_ice,
+                                                       double temp,
+                                                       double* dporosity,
+                                                       double* dsat_liq,
+                                                       double* dsat_ice,
+                                                       double* dtemp)
+  {
+    return ThermalConductivityAndDerivatives(
+      porosity, sat_liq, sat_ice, temp, dporosity, dsat_liq, dsat_ice, dtemp);
+  }
 };
 
 } // namespace Energy
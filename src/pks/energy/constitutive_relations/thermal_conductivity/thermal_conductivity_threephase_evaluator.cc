@@ -13,6 +13,8 @@
 
 */
 
+#include <array>
+
 #include "dbc.hh"
 #include "thermal_conductivity_threephase_factory.hh"
 #include "thermal_conductivity_threephase_evaluator.hh"
@@ -22,7 +24,7 @@ namespace Energy {
 
 ThermalConductivityThreePhaseEvaluator::ThermalConductivityThreePhaseEvaluator(
   Teuchos::ParameterList& plist)
-  : EvaluatorSecondaryMonotypeCV(plist)
+  : EvaluatorSecondaryMonotypeCV(plist), partials_valid_(false)
 {
   Key domain = Keys::getDomain(my_keys_.front().first);
   Tag tag = my_keys_.front().second;
@@ -62,6 +64,20 @@ ThermalConductivityThreePhaseEvaluator::ThermalConductivityThreePhaseEvaluator(
 }
 
 
+// Copy constructor, which does not share the cached partials
+ThermalConductivityThreePhaseEvaluator::ThermalConductivityThreePhaseEvaluator(
+  const ThermalConductivityThreePhaseEvaluator& other)
+  : EvaluatorSecondaryMonotypeCV(other),
+    tcs_(other.tcs_),
+    region_cells_(other.region_cells_),
+    poro_key_(other.poro_key_),
+    sat_key_(other.sat_key_),
+    sat2_key_(other.sat2_key_),
+    temp_key_(other.temp_key_),
+    partials_valid_(false)
+{}
+
+
 Teuchos::RCP<Evaluator>
 ThermalConductivityThreePhaseEvaluator::Clone() const
 {
@@ -69,6 +85,30 @@ ThermalConductivityThreePhaseEvaluator::Clone() const
 }
 
 
+const std::vector<AmanziMesh::Entity_ID_List>&
+ThermalConductivityThreePhaseEvaluator::RegionCells_(const AmanziMesh::Mesh& mesh)
+{
+  // region sets do not change, so look them up once
+  if (region_cells_.size() != tcs_.size()) {
+    region_cells_.resize(tcs_.size());
+    for (int r = 0; r != tcs_.size(); ++r) {
+      const std::string& region_name = tcs_[r].first;
+      if (mesh.valid_set_name(region_name, AmanziMesh::CELL)) {
+        mesh.get_set_entities(
+          region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &region_cells_[r]);
+      } else {
+        region_cells_.clear();
+        std::stringstream m;
+        m << "Thermal conductivity evaluator: unknown region on cells: \"" << region_name << "\"";
+        Errors::Message message(m.str());
+        Exceptions::amanzi_throw(message);
+      }
+    }
+  }
+  return region_cells_;
+}
+
+
 void
 ThermalConductivityThreePhaseEvaluator::Evaluate_(const State& S,
                                                   const std::vector<CompositeVector*>& result)
@@ -80,7 +120,7 @@ ThermalConductivityThreePhaseEvaluator::Evaluate_(const State& S,
   Teuchos::RCP<const CompositeVector> temp = S.GetPtr<CompositeVector>(temp_key_, tag);
   Teuchos::RCP<const CompositeVector> sat = S.GetPtr<CompositeVector>(sat_key_, tag);
   Teuchos::RCP<const CompositeVector> sat2 = S.GetPtr<CompositeVector>(sat2_key_, tag);
-  Teuchos::RCP<const AmanziMesh::Mesh> mesh = result[0]->Mesh();
+  const auto& region_cells = RegionCells_(*result[0]->Mesh());
 
   for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end(); ++comp) {
     AMANZI_ASSERT(*comp == "cell");
@@ -90,30 +130,25 @@ ThermalConductivityThreePhaseEvaluator::Evaluate_(const State& S,
     const Epetra_MultiVector& sat2_v = *sat2->ViewComponent(*comp, false);
     Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
-    for (std::vector<RegionModelPair>::const_iterator lcv = tcs_.begin(); lcv != tcs_.end();
-         ++lcv) {
-      std::string region_name = lcv->first;
-      if (mesh->valid_set_name(region_name, AmanziMesh::CELL)) {
-        // get the indices of the domain.
-        AmanziMesh::Entity_ID_List id_list;
-        mesh->get_set_entities(
-          region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &id_list);
-
-        // loop over indices
-        for (AmanziMesh::Entity_ID_List::const_iterator id = id_list.begin(); id != id_list.end();
-             ++id) {
-          result_v[0][*id] = lcv->second->ThermalConductivity(
-            poro_v[0][*id], sat_v[0][*id], sat2_v[0][*id], temp_v[0][*id]);
-        }
-      } else {
-        std::stringstream m;
-        m << "Thermal conductivity evaluator: unknown region on cells: \"" << region_name << "\"";
-        Errors::Message message(m.str());
-        Exceptions::amanzi_throw(message);
+    for (int r = 0; r != tcs_.size(); ++r) {
+      const auto& tc = tcs_[r].second;
+      for (const auto& c : region_cells[r]) {
+        result_v[0][c] = tc->CellThermalConductivityAndDerivatives(c,
+                                                                   poro_v[0][c],
+                                                                   sat_v[0][c],
+                                                                   sat2_v[0][c],
+                                                                   temp_v[0][c],
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   nullptr);
       }
     }
   }
   result[0]->Scale(1.e-6); // convert to MJ
+
+  // the dependencies changed, so the cached partials are stale
+  partials_valid_ = false;
 }
 
 
@@ -131,120 +166,56 @@ ThermalConductivityThreePhaseEvaluator::EvaluatePartialDerivative_(
   Teuchos::RCP<const CompositeVector> temp = S.GetPtr<CompositeVector>(temp_key_, tag);
   Teuchos::RCP<const CompositeVector> sat = S.GetPtr<CompositeVector>(sat_key_, tag);
   Teuchos::RCP<const CompositeVector> sat2 = S.GetPtr<CompositeVector>(sat2_key_, tag);
-  Teuchos::RCP<const AmanziMesh::Mesh> mesh = result[0]->Mesh();
-
-  for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end(); ++comp) {
-    AMANZI_ASSERT(*comp == "cell");
-    const Epetra_MultiVector& poro_v = *poro->ViewComponent(*comp, false);
-    const Epetra_MultiVector& temp_v = *temp->ViewComponent(*comp, false);
-    const Epetra_MultiVector& sat_v = *sat->ViewComponent(*comp, false);
-    const Epetra_MultiVector& sat2_v = *sat2->ViewComponent(*comp, false);
-    Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-    if (wrt_key == poro_key_) {
-      for (std::vector<RegionModelPair>::const_iterator lcv = tcs_.begin(); lcv != tcs_.end();
-           ++lcv) {
-        std::string region_name = lcv->first;
-        if (mesh->valid_set_name(region_name, AmanziMesh::CELL)) {
-          // get the indices of the domain.
-          AmanziMesh::Entity_ID_List id_list;
-          mesh->get_set_entities(
-            region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &id_list);
-
-          // loop over indices
-          for (AmanziMesh::Entity_ID_List::const_iterator id = id_list.begin(); id != id_list.end();
-               ++id) {
-            result_v[0][*id] = lcv->second->DThermalConductivity_DPorosity(
-              poro_v[0][*id], sat_v[0][*id], sat2_v[0][*id], temp_v[0][*id]);
-          }
-        } else {
-          std::stringstream m;
-          m << "Thermal conductivity evaluator: unknown region on cells: \"" << region_name << "\"";
-          Errors::Message message(m.str());
-          Exceptions::amanzi_throw(message);
-        }
-      }
-
-    } else if (wrt_key == sat_key_) {
-      for (std::vector<RegionModelPair>::const_iterator lcv = tcs_.begin(); lcv != tcs_.end();
-           ++lcv) {
-        std::string region_name = lcv->first;
-        if (mesh->valid_set_name(region_name, AmanziMesh::CELL)) {
-          // get the indices of the domain.
-          AmanziMesh::Entity_ID_List id_list;
-          mesh->get_set_entities(
-            region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &id_list);
-
-          // loop over indices
-          for (AmanziMesh::Entity_ID_List::const_iterator id = id_list.begin(); id != id_list.end();
-               ++id) {
-            result_v[0][*id] = lcv->second->DThermalConductivity_DSaturationLiquid(
-              poro_v[0][*id], sat_v[0][*id], sat2_v[0][*id], temp_v[0][*id]);
-          }
-        } else {
-          std::stringstream m;
-          m << "Thermal conductivity evaluator: unknown region on cells: \"" << region_name << "\"";
-          Errors::Message message(m.str());
-          Exceptions::amanzi_throw(message);
-        }
-      }
+  const auto& region_cells = RegionCells_(*result[0]->Mesh());
+
+  const std::array<const Key*, 4> wrt_keys = { &poro_key_, &sat_key_, &sat2_key_, &temp_key_ };
+  std::size_t k = 0;
+  while (k != wrt_keys.size() && *wrt_keys[k] != wrt_key) ++k;
+  AMANZI_ASSERT(k != wrt_keys.size());
+
+  // The DAG requests one partial at a time, but they share the Kersten
+  // numbers and porosity terms, so all are computed in a single sweep on the
+  // first request after Evaluate_() and then served from partials_.
+  if (!partials_valid_) {
+    if (partials_.size() != wrt_keys.size()) {
+      partials_.resize(wrt_keys.size());
+      for (auto& partial : partials_) partial = Teuchos::rcp(new CompositeVector(result[0]->Map()));
+    }
 
-    } else if (wrt_key == sat2_key_) {
-      for (std::vector<RegionModelPair>::const_iterator lcv = tcs_.begin(); lcv != tcs_.end();
-           ++lcv) {
-        std::string region_name = lcv->first;
-        if (mesh->valid_set_name(region_name, AmanziMesh::CELL)) {
-          // get the indices of the domain.
-          AmanziMesh::Entity_ID_List id_list;
-          mesh->get_set_entities(
-            region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &id_list);
-
-          // loop over indices
-          for (AmanziMesh::Entity_ID_List::const_iterator id = id_list.begin(); id != id_list.end();
-               ++id) {
-            result_v[0][*id] = lcv->second->DThermalConductivity_DSaturationIce(
-              poro_v[0][*id], sat_v[0][*id], sat2_v[0][*id], temp_v[0][*id]);
-          }
-        } else {
-          std::stringstream m;
-          m << "Thermal conductivity evaluator: unknown region on cells: \"" << region_name << "\"";
-          Errors::Message message(m.str());
-          Exceptions::amanzi_throw(message);
-        }
+    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
+         ++comp) {
+      AMANZI_ASSERT(*comp == "cell");
+      const Epetra_MultiVector& poro_v = *poro->ViewComponent(*comp, false);
+      const Epetra_MultiVector& temp_v = *temp->ViewComponent(*comp, false);
+      const Epetra_MultiVector& sat_v = *sat->ViewComponent(*comp, false);
+      const Epetra_MultiVector& sat2_v = *sat2->ViewComponent(*comp, false);
+      std::array<Epetra_MultiVector*, 4> d_v;
+      for (std::size_t j = 0; j != d_v.size(); ++j) {
+        d_v[j] = partials_[j]->ViewComponent(*comp, false).get();
       }
 
-    } else if (wrt_key == temp_key_) {
-      for (std::vector<RegionModelPair>::const_iterator lcv = tcs_.begin(); lcv != tcs_.end();
-           ++lcv) {
-        std::string region_name = lcv->first;
-        if (mesh->valid_set_name(region_name, AmanziMesh::CELL)) {
-          // get the indices of the domain.
-          AmanziMesh::Entity_ID_List id_list;
-          mesh->get_set_entities(
-            region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &id_list);
-
-          // loop over indices
-          for (AmanziMesh::Entity_ID_List::const_iterator id = id_list.begin(); id != id_list.end();
-               ++id) {
-            result_v[0][*id] = lcv->second->DThermalConductivity_DTemperature(
-              poro_v[0][*id], sat_v[0][*id], sat2_v[0][*id], temp_v[0][*id]);
-          }
-        } else {
-          std::stringstream m;
-          m << "Thermal conductivity evaluator: unknown region on cells: \"" << region_name << "\"";
-          Errors::Message message(m.str());
-          Exceptions::amanzi_throw(message);
+      for (int r = 0; r != tcs_.size(); ++r) {
+        const auto& tc = tcs_[r].second;
+        for (const auto& c : region_cells[r]) {
+          tc->CellThermalConductivityAndDerivatives(c,
+                                                    poro_v[0][c],
+                                                    sat_v[0][c],
+                                                    sat2_v[0][c],
+                                                    temp_v[0][c],
+                                                    &(*d_v[0])[0][c],
+                                                    &(*d_v[1])[0][c],
+                                                    &(*d_v[2])[0][c],
+                                                    &(*d_v[3])[0][c]);
         }
       }
-
-    } else {
-      AMANZI_ASSERT(false);
     }
-  }
 
-  result[0]->Scale(1.e-6); // convert to MJ
+    // convert to MJ
+    for (auto& partial : partials_) partial->Scale(1.e-6);
+    partials_valid_ = true;
+  }
 
-  Epetra_MultiVector& result_v = *result[0]->ViewComponent("cell", false);
+  *result[0] = *partials_[k];
 }
 
 } // namespace Energy
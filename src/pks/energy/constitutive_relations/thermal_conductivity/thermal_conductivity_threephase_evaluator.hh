@@ -43,8 +43,7 @@ class ThermalConductivityThreePhaseEvaluator : public EvaluatorSecondaryMonotype
 
   // constructor format for all derived classes
   ThermalConductivityThreePhaseEvaluator(Teuchos::ParameterList& plist);
-  ThermalConductivityThreePhaseEvaluator(const ThermalConductivityThreePhaseEvaluator& other) =
-    default;
+  ThermalConductivityThreePhaseEvaluator(const ThermalConductivityThreePhaseEvaluator& other);
 
   Teuchos::RCP<Evaluator> Clone() const override;
 
@@ -56,8 +55,11 @@ class ThermalConductivityThreePhaseEvaluator : public EvaluatorSecondaryMonotype
                                           const Tag& wrt_tag,
                                           const std::vector<CompositeVector*>& result) override;
 
+  const std::vector<AmanziMesh::Entity_ID_List>& RegionCells_(const AmanziMesh::Mesh& mesh);
+
  protected:
   std::vector<RegionModelPair> tcs_;
+  std::vector<AmanziMesh::Entity_ID_List> region_cells_;
 
   // Keys for fields
   // dependencies
@@ -66,6 +68,12 @@ class ThermalConductivityThreePhaseEvaluator : public EvaluatorSecondaryMonotype
   Key sat2_key_;
   Key temp_key_;
 
+  // partial derivatives with respect to porosity, saturation liquid, second
+  // saturation, and temperature, all computed on the first request after the
+  // value is updated
+  std::vector<Teuchos::RCP<CompositeVector>> partials_;
+  bool partials_valid_;
+
  private:
   static Utils::RegisteredFactory<Evaluator, ThermalConductivityThreePhaseEvaluator> factory_;
 };
@@ -32,13 +32,129 @@ ThermalConductivityThreePhasePetersLidard::ThermalConductivity(double poro,
                                                                double sat_ice,
                                                                double temp)
 {
-  double k_dry = (d_ * (1 - poro) * k_soil_ + k_gas_ * poro) / (d_ * (1 - poro) + poro);
-  double k_sat_u = pow(k_soil_, (1 - poro)) * pow(k_liquid_, poro);
-  double k_sat_f = pow(k_soil_, (1 - poro)) * pow(k_ice_, poro);
+  return ThermalConductivityAndDerivatives(
+    poro, sat_liq, sat_ice, temp, nullptr, nullptr, nullptr, nullptr);
+};
+
+
+double
+ThermalConductivityThreePhasePetersLidard::DThermalConductivity_DPorosity(double poro,
+                                                                          double sat_liq,
+                                                                          double sat_ice,
+                                                                          double temp)
+{
+  double dporo;
+  ThermalConductivityAndDerivatives(
+    poro, sat_liq, sat_ice, temp, &dporo, nullptr, nullptr, nullptr);
+  return dporo;
+}
+
+
+double
+ThermalConductivityThreePhasePetersLidard::DThermalConductivity_DSaturationLiquid(double poro,
+                                                                                  double sat_liq,
+                                                                                  double sat_ice,
+                                                                                  double temp)
+{
+  double dsat_liq;
+  ThermalConductivityAndDerivatives(
+    poro, sat_liq, sat_ice, temp, nullptr, &dsat_liq, nullptr, nullptr);
+  return dsat_liq;
+}
+
+
+double
+ThermalConductivityThreePhasePetersLidard::DThermalConductivity_DSaturationIce(double poro,
+                                                                               double sat_liq,
+                                                                               double sat_ice,
+                                                                               double temp)
+{
+  double dsat_ice;
+  ThermalConductivityAndDerivatives(
+    poro, sat_liq, sat_ice, temp, nullptr, nullptr, &dsat_ice, nullptr);
+  return dsat_ice;
+}
+
+
+double
+ThermalConductivityThreePhasePetersLidard::ThermalConductivityAndDerivatives(double poro,
+                                                                             double sat_liq,
+                                                                             double sat_ice,
+                                                                             double temp,
+                                                                             double* dporosity,
+                                                                             double* dsat_liq,
+                                                                             double* dsat_ice,
+                                                                             double* dtemp)
+{
+  PorosityTerms terms;
+  ComputePorosityTerms_(poro, terms);
+  return Evaluate_(terms, sat_liq, sat_ice, dporosity, dsat_liq, dsat_ice, dtemp);
+}
+
+
+double
+ThermalConductivityThreePhasePetersLidard::CellThermalConductivityAndDerivatives(int c,
+                                                                                 double poro,
+                                                                                 double sat_liq,
+                                                                                 double sat_ice,
+                                                                                 double temp,
+                                                                                 double* dporosity,
+                                                                                 double* dsat_liq,
+                                                                                 double* dsat_ice,
+                                                                                 double* dtemp)
+{
+  if (c >= (int)cell_terms_.size()) {
+    // NaN porosity never compares equal, so new entries are always computed
+    PorosityTerms unset;
+    unset.poro = std::nan("");
+    cell_terms_.resize(c + 1, unset);
+  }
+  PorosityTerms& terms = cell_terms_[c];
+  if (terms.poro != poro) ComputePorosityTerms_(poro, terms);
+  return Evaluate_(terms, sat_liq, sat_ice, dporosity, dsat_liq, dsat_ice, dtemp);
+}
+
+
+double
+ThermalConductivityThreePhasePetersLidard::Evaluate_(const PorosityTerms& terms,
+                                                     double sat_liq,
+                                                     double sat_ice,
+                                                     double* dporosity,
+                                                     double* dsat_liq,
+                                                     double* dsat_ice,
+                                                     double* dtemp) const
+{
   double kersten_u = pow(sat_liq + eps_, alpha_u_);
   double kersten_f = pow(sat_ice + eps_, alpha_f_);
-  return kersten_f * k_sat_f + kersten_u * k_sat_u + (1.0 - kersten_f - kersten_u) * k_dry;
-};
+
+  if (dporosity)
+    *dporosity = kersten_f * terms.dk_sat_f + kersten_u * terms.dk_sat_u +
+                 (1.0 - kersten_f - kersten_u) * terms.dk_dry;
+  if (dsat_liq) *dsat_liq = alpha_u_ * kersten_u / (sat_liq + eps_) * (terms.k_sat_u - terms.k_dry);
+  if (dsat_ice) *dsat_ice = alpha_f_ * kersten_f / (sat_ice + eps_) * (terms.k_sat_f - terms.k_dry);
+  if (dtemp) *dtemp = 0.;
+  return kersten_f * terms.k_sat_f + kersten_u * terms.k_sat_u +
+         (1.0 - kersten_f - kersten_u) * terms.k_dry;
+}
+
+
+void
+ThermalConductivityThreePhasePetersLidard::ComputePorosityTerms_(double poro,
+                                                                 PorosityTerms& terms) const
+{
+  terms.poro = poro;
+
+  double numer = d_ * (1 - poro) * k_soil_ + k_gas_ * poro;
+  double denom = d_ * (1 - poro) + poro;
+  terms.k_dry = numer / denom;
+  terms.dk_dry = ((k_gas_ - d_ * k_soil_) * denom - numer * (1 - d_)) / (denom * denom);
+
+  // k_soil^(1-poro) * k^poro = k_soil * exp(poro * log(k / k_soil))
+  terms.k_sat_u = k_soil_ * std::exp(poro * log_ratio_u_);
+  terms.k_sat_f = k_soil_ * std::exp(poro * log_ratio_f_);
+  terms.dk_sat_u = terms.k_sat_u * log_ratio_u_;
+  terms.dk_sat_f = terms.k_sat_f * log_ratio_f_;
+}
 
 void
 ThermalConductivityThreePhasePetersLidard::InitializeFromPlist_()
@@ -52,6 +168,9 @@ ThermalConductivityThreePhasePetersLidard::InitializeFromPlist_()
   k_ice_ = plist_.get<double>("thermal conductivity of ice [W m^-1 K^-1]");
   k_liquid_ = plist_.get<double>("thermal conductivity of liquid [W m^-1 K^-1]");
   k_gas_ = plist_.get<double>("thermal conductivity of gas [W m^-1 K^-1]");
+
+  log_ratio_u_ = std::log(k_liquid_ / k_soil_);
+  log_ratio_f_ = std::log(k_ice_ / k_soil_);
 };
 
 } // namespace Energy
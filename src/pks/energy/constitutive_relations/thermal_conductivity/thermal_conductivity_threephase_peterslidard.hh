@@ -53,6 +53,8 @@ Example:
 #ifndef PK_ENERGY_RELATIONS_THERMAL_CONDUCTIVITY_THREEPHASE_PETERSLIDARD_HH_
 #define PK_ENERGY_RELATIONS_THERMAL_CONDUCTIVITY_THREEPHASE_PETERSLIDARD_HH_
 
+#include <vector>
+
 #include "Teuchos_ParameterList.hpp"
 
 #include "Factory.hh"
@@ -67,8 +69,56 @@ class ThermalConductivityThreePhasePetersLidard : public ThermalConductivityThre
 
   double ThermalConductivity(double porosity, double sat_liq, double sat_ice, double temp);
 
+  double
+  DThermalConductivity_DPorosity(double porosity, double sat_liq, double sat_ice, double temp);
+  double DThermalConductivity_DSaturationLiquid(double porosity,
+                                                double sat_liq,
+                                                double sat_ice,
+                                                double temp);
+  double
+  DThermalConductivity_DSaturationIce(double porosity, double sat_liq, double sat_ice, double temp);
+  double
+  DThermalConductivity_DTemperature(double porosity, double sat_liq, double sat_ice, double temp)
+  {
+    return 0.;
+  }
+
+  double ThermalConductivityAndDerivatives(double porosity,
+                                           double sat_liq,
+                                           double sat_ice,
+                                           double temp,
+                                           double* dporosity,
+                                           double* dsat_liq,
+                                           double* dsat_ice,
+                                           double* dtemp);
+
+  double CellThermalConductivityAndDerivatives(int c,
+                                               double porosity,
+                                               double sat_liq,
+                                               double sat_ice,
+                                               double temp,
+                                               double* dporosity,
+                                               double* dsat_liq,
+                                               double* dsat_ice,
+                                               double* dtemp);
+
  private:
+  // terms that depend only on porosity, and their porosity derivatives
+  struct PorosityTerms {
+    double poro;
+    double k_dry, k_sat_u, k_sat_f;
+    double dk_dry, dk_sat_u, dk_sat_f;
+  };
+
   void InitializeFromPlist_();
+  void ComputePorosityTerms_(double poro, PorosityTerms& terms) const;
+  double Evaluate_(const PorosityTerms& terms,
+                   double sat_liq,
+                   double sat_ice,
+                   double* dporosity,
+                   double* dsat_liq,
+                   double* dsat_ice,
+                   double* dtemp) const;
 
   Teuchos::ParameterList plist_;
 
@@ -81,6 +131,16 @@ class ThermalConductivityThreePhasePetersLidard : public ThermalConductivityThre
   double k_gas_;
   double d_;
 
+  // log(k_liquid / k_soil) and log(k_ice / k_soil)
+  double log_ratio_u_;
+  double log_ratio_f_;
+
+  // Porosity terms of each cell, recomputed for a cell only when its
+  // porosity differs from the one they were computed with.  Porosity changes
+  // from cell to cell but rarely in time, so this saves the exponentials on
+  // every evaluation after the first.
+  std::vector<PorosityTerms> cell_terms_;
+
  private:
   static Utils::RegisteredFactory<ThermalConductivityThreePhase,
                                   ThermalConductivityThreePhasePetersLidard>
@@ -194,9 +194,10 @@ class EnergyBase : public PK_PhysicalBDF_Default {
   virtual void CalculateDiagnostics(const Tag& tag) override {}
 
   // Default implementations of BDFFnBase methods.
-  // -- Compute a norm on u-du and return the result.
-  virtual double
-  ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> du) override;
+  // -- Compute rank-local contributions to the norm on u-du.
+  virtual void ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                              Teuchos::RCP<const TreeVector> du,
+                              ErrorNormAccumulator& enorm) override;
 
   // EnergyBase is a BDFFnBase
   // computes the non-linear functional f = f(t,u,udot)
@@ -270,8 +270,10 @@ EnergyBase::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, do
 // -----------------------------------------------------------------------------
 // Default enorm that uses an abs and rel tolerance to monitor convergence.
 // -----------------------------------------------------------------------------
-double
-EnergyBase::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> res)
+void
+EnergyBase::ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                           Teuchos::RCP<const TreeVector> res,
+                           ErrorNormAccumulator& enorm)
 {
   // Abs tol based on old conserved quantity -- we know these have been vetted
   // at some level whereas the new quantity is some iterate, and may be
@@ -287,20 +289,9 @@ EnergyBase::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeV
   const Epetra_MultiVector& cv =
     *S_->Get<CompositeVector>(cell_vol_key_, tag_next_).ViewComponent("cell", true);
 
-  // VerboseObject stuff.
-  Teuchos::OSTab tab = vo_->getOSTab();
-  if (vo_->os_OK(Teuchos::VERB_MEDIUM))
-    *vo_->os() << "ENorm (Infnorm) of: " << conserved_key_ << ": " << std::endl;
-
   Teuchos::RCP<const CompositeVector> dvec = res->Data();
   double h = S_->get_time(tag_next_) - S_->get_time(tag_current_);
 
-  Teuchos::RCP<const Comm_type> comm_p = mesh_->get_comm();
-  Teuchos::RCP<const MpiComm_type> mpi_comm_p =
-    Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_p);
-  const MPI_Comm& comm = mpi_comm_p->Comm();
-
-  double enorm_val = 0.0;
   for (CompositeVector::name_iterator comp = dvec->begin(); comp != dvec->end(); ++comp) {
     double enorm_comp = 0.0;
     int enorm_loc = -1;
@@ -325,15 +316,14 @@ EnergyBase::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeV
     } else if (*comp == std::string("face")) {
       // error in flux -- relative to cell's extensive conserved quantity
       int nfaces = dvec->size(*comp, false);
+      const auto& face_cells = FaceCells_();
 
       for (unsigned int f = 0; f != nfaces; ++f) {
-        AmanziMesh::Entity_ID_List cells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::OWNED, &cells);
-        double cv_min =
-          cells.size() == 1 ? cv[0][cells[0]] : std::min(cv[0][cells[0]], cv[0][cells[1]]);
-        double mass_min = cells.size() == 1 ? wc[0][cells[0]] / cv[0][cells[0]] :
-                                              std::min(wc[0][cells[0]] / cv[0][cells[0]],
-                                                       wc[0][cells[1]] / cv[0][cells[1]]);
+        AmanziMesh::Entity_ID c0 = face_cells[2 * f];
+        AmanziMesh::Entity_ID c1 = face_cells[2 * f + 1];
+        double cv_min = c1 < 0 ? cv[0][c0] : std::min(cv[0][c0], cv[0][c1]);
+        double mass_min = c1 < 0 ? wc[0][c0] / cv[0][c0] :
+                                   std::min(wc[0][c0] / cv[0][c0], wc[0][c1] / cv[0][c1]);
         mass_min = std::max(mass_min, mass_atol_);
 
         double energy = mass_min * atol_ + soil_atol_;
@@ -347,38 +337,15 @@ EnergyBase::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeV
 
     } else {
       // boundary face components had better be effectively identically 0
-      double norm;
-      dvec_v.Norm2(&norm);
-      AMANZI_ASSERT(norm < 1.e-15);
-    }
-
-
-    // Write out Inf norms too.
-    if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
-      double infnorm(0.);
-      dvec_v.NormInf(&infnorm);
-
-      ENorm_t err;
-      ENorm_t l_err;
-      l_err.value = enorm_comp;
-      l_err.gid = dvec_v.Map().GID(enorm_loc);
-
-      int ierr;
-      ierr = MPI_Allreduce(&l_err, &err, 1, MPI_DOUBLE_INT, MPI_MAXLOC, comm);
-      AMANZI_ASSERT(!ierr);
-      *vo_->os() << "  ENorm (" << *comp << ") = " << err.value << "[" << err.gid << "] ("
-                 << infnorm << ")" << std::endl;
+      AMANZI_ASSERT(LocalInfNorm_(dvec_v) < 1.e-15);
     }
 
-    enorm_val = std::max(enorm_val, enorm_comp);
+    enorm.Add(conserved_key_,
+              *comp,
+              enorm_comp,
+              dvec_v.Map().GID(enorm_loc),
+              LocalInfNorm_(dvec_v));
   }
-
-  double enorm_val_l = enorm_val;
-
-  int ierr;
-  ierr = MPI_Allreduce(&enorm_val_l, &enorm_val, 1, MPI_DOUBLE, MPI_MAX, comm);
-  AMANZI_ASSERT(!ierr);
-  return enorm_val;
 };
 
 
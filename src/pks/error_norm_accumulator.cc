@@ -0,0 +1,68 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include "errors.hh"
+#include "error_norm_accumulator.hh"
+
+namespace Amanzi {
+
+void
+ErrorNormAccumulator::Add(const std::string& name,
+                          const std::string& component,
+                          double enorm,
+                          int gid,
+                          double infnorm)
+{
+  AMANZI_ASSERT(!reduced_);
+  names_.emplace_back(name);
+  components_.emplace_back(component);
+  enorms_.emplace_back(ENorm_t{ enorm, gid });
+  enorms_.emplace_back(ENorm_t{ infnorm, -1 });
+}
+
+
+double
+ErrorNormAccumulator::Reduce(const Comm_type& comm)
+{
+  AMANZI_ASSERT(!reduced_);
+  const auto* mpi_comm = dynamic_cast<const MpiComm_type*>(&comm);
+  if (mpi_comm != nullptr && enorms_.size() > 0) {
+    std::vector<ENorm_t> l_enorms(enorms_);
+    int ierr = MPI_Allreduce(l_enorms.data(),
+                             enorms_.data(),
+                             (int)enorms_.size(),
+                             MPI_DOUBLE_INT,
+                             MPI_MAXLOC,
+                             mpi_comm->Comm());
+    AMANZI_ASSERT(!ierr);
+  }
+  reduced_ = true;
+
+  double enorm_val = 0.;
+  for (int i = 0; i != size(); ++i) enorm_val = std::max(enorm_val, enorms_[2 * i].value);
+  return enorm_val;
+}
+
+
+void
+ErrorNormAccumulator::Write(const VerboseObject& vo) const
+{
+  AMANZI_ASSERT(reduced_);
+  std::string name;
+  for (int i = 0; i != size(); ++i) {
+    if (names_[i] != name) {
+      name = names_[i];
+      *vo.os() << "ENorm (Infnorm) of: " << name << ": " << std::endl;
+    }
+    *vo.os() << "  ENorm (" << components_[i] << ") = " << enorms_[2 * i].value << "["
+             << enorms_[2 * i].gid << "] (" << enorms_[2 * i + 1].value << ")" << std::endl;
+  }
+}
+
+} // namespace Amanzi
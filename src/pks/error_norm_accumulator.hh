@@ -0,0 +1,64 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Collects rank-local error norms across a tree of PKs.
+/*!
+
+Each PK in a tree adds its rank-local, per-component error norms (and the
+location of the max), along with the local inf norm of the residual.  All
+contributions are then reduced with a single MPI_MAXLOC reduction, rather than
+one or more reductions per PK and per component.
+
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "AmanziComm.hh"
+#include "VerboseObject.hh"
+
+namespace Amanzi {
+
+class ErrorNormAccumulator {
+ public:
+  ErrorNormAccumulator() : reduced_(false) {}
+
+  // Add a rank-local contribution: the max norm on this rank, its location
+  // (global ID), and the local inf norm of the residual.
+  void Add(const std::string& name,
+           const std::string& component,
+           double enorm,
+           int gid,
+           double infnorm);
+
+  // Reduce all contributions in a single reduction, returning the max norm.
+  double Reduce(const Comm_type& comm);
+
+  // Write the reduced contributions.
+  void Write(const VerboseObject& vo) const;
+
+  std::size_t size() const { return names_.size(); }
+
+ private:
+  // layout matches MPI_DOUBLE_INT
+  struct ENorm_t {
+    double value;
+    int gid;
+  };
+
+  // two entries per contribution: the norm and the inf norm
+  std::vector<ENorm_t> enorms_;
+  std::vector<std::string> names_;
+  std::vector<std::string> components_;
+  bool reduced_;
+};
+
+} // namespace Amanzi
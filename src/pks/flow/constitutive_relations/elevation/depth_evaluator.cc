@@ -41,7 +41,7 @@ DepthEvaluator::Update_(State& S)
       if (comp == "cell") {
         // evaluate depths
         Epetra_MultiVector& depth = *result.ViewComponent("cell", false);
-        const AmanziMesh::Mesh& mesh = *result.Mesh();
+        const auto& mesh = result.Mesh();
         if (algorithm_ == "mean face centroid") {
           computeDepth_MeanFaceCentroid(mesh, depth);
         } else {
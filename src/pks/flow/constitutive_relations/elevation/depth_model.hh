@@ -23,10 +23,12 @@ namespace Amanzi {
 namespace Flow {
 
 void
-computeDepth_MeanFaceCentroid(const AmanziMesh::Mesh& mesh, Epetra_MultiVector& depth);
+computeDepth_MeanFaceCentroid(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+                              Epetra_MultiVector& depth);
 
 void
-computeDepth_CellCentroid(const AmanziMesh::Mesh& mesh, Epetra_MultiVector& depth);
+computeDepth_CellCentroid(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+                          Epetra_MultiVector& depth);
 
 } // namespace Flow
 } // namespace Amanzi
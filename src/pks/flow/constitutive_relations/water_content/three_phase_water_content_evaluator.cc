@@ -13,6 +13,8 @@ Water content for a three-phase, gas+liquid+ice evaluator.
   Generated via evaluator_generator.
 */
 
+#include <array>
+
 #include "three_phase_water_content_evaluator.hh"
 #include "three_phase_water_content_model.hh"
 
@@ -22,7 +24,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 ThreePhaseWaterContentEvaluator::ThreePhaseWaterContentEvaluator(Teuchos::ParameterList& plist)
-  : EvaluatorSecondaryMonotypeCV(plist)
+  : EvaluatorSecondaryMonotypeCV(plist), partials_valid_(false)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("three_phase_water_content parameters");
   model_ = Teuchos::rcp(new ThreePhaseWaterContentModel(sublist));
@@ -30,6 +32,24 @@ ThreePhaseWaterContentEvaluator::ThreePhaseWaterContentEvaluator(Teuchos::Parame
 }
 
 
+// Copy constructor, which does not share the cached partials
+ThreePhaseWaterContentEvaluator::ThreePhaseWaterContentEvaluator(
+  const ThreePhaseWaterContentEvaluator& other)
+  : EvaluatorSecondaryMonotypeCV(other),
+    phi_key_(other.phi_key_),
+    sl_key_(other.sl_key_),
+    nl_key_(other.nl_key_),
+    si_key_(other.si_key_),
+    ni_key_(other.ni_key_),
+    sg_key_(other.sg_key_),
+    ng_key_(other.ng_key_),
+    omega_key_(other.omega_key_),
+    cv_key_(other.cv_key_),
+    model_(other.model_),
+    partials_valid_(false)
+{}
+
+
 // Virtual copy constructor
 Teuchos::RCP<Evaluator>
 ThreePhaseWaterContentEvaluator::Clone() const
@@ -90,6 +110,9 @@ void
 ThreePhaseWaterContentEvaluator::Evaluate_(const State& S,
                                            const std::vector<CompositeVector*>& result)
 {
+  // the dependencies changed, so the cached partials are stale
+  partials_valid_ = false;
+
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> phi = S.GetPtr<CompositeVector>(phi_key_, tag);
   Teuchos::RCP<const CompositeVector> sl = S.GetPtr<CompositeVector>(sl_key_, tag);
@@ -114,17 +137,17 @@ ThreePhaseWaterContentEvaluator::Evaluate_(const State& S,
     Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
     int ncomp = result[0]->size(*comp, false);
-    for (int i = 0; i != ncomp; ++i) {
-      result_v[0][i] = model_->WaterContent(phi_v[0][i],
-                                            sl_v[0][i],
-                                            nl_v[0][i],
-                                            si_v[0][i],
-                                            ni_v[0][i],
-                                            sg_v[0][i],
-                                            ng_v[0][i],
-                                            omega_v[0][i],
-                                            cv_v[0][i]);
-    }
+    model_->WaterContent(ncomp,
+                         phi_v[0],
+                         sl_v[0],
+                         nl_v[0],
+                         si_v[0],
+                         ni_v[0],
+                         sg_v[0],
+                         ng_v[0],
+                         omega_v[0],
+                         cv_v[0],
+                         result_v[0]);
   }
 }
 
@@ -147,203 +170,22 @@ ThreePhaseWaterContentEvaluator::EvaluatePartialDerivative_(
   Teuchos::RCP<const CompositeVector> omega = S.GetPtr<CompositeVector>(omega_key_, tag);
   Teuchos::RCP<const CompositeVector> cv = S.GetPtr<CompositeVector>(cv_key_, tag);
 
-  if (wrt_key == phi_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDPorosity(phi_v[0][i],
-                                                        sl_v[0][i],
-                                                        nl_v[0][i],
-                                                        si_v[0][i],
-                                                        ni_v[0][i],
-                                                        sg_v[0][i],
-                                                        ng_v[0][i],
-                                                        omega_v[0][i],
-                                                        cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == sl_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDSaturationLiquid(phi_v[0][i],
-                                                                sl_v[0][i],
-                                                                nl_v[0][i],
-                                                                si_v[0][i],
-                                                                ni_v[0][i],
-                                                                sg_v[0][i],
-                                                                ng_v[0][i],
-                                                                omega_v[0][i],
-                                                                cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == nl_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDMolarDensityLiquid(phi_v[0][i],
-                                                                  sl_v[0][i],
-                                                                  nl_v[0][i],
-                                                                  si_v[0][i],
-                                                                  ni_v[0][i],
-                                                                  sg_v[0][i],
-                                                                  ng_v[0][i],
-                                                                  omega_v[0][i],
-                                                                  cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == si_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDSaturationIce(phi_v[0][i],
-                                                             sl_v[0][i],
-                                                             nl_v[0][i],
-                                                             si_v[0][i],
-                                                             ni_v[0][i],
-                                                             sg_v[0][i],
-                                                             ng_v[0][i],
-                                                             omega_v[0][i],
-                                                             cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == ni_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDMolarDensityIce(phi_v[0][i],
-                                                               sl_v[0][i],
-                                                               nl_v[0][i],
-                                                               si_v[0][i],
-                                                               ni_v[0][i],
-                                                               sg_v[0][i],
-                                                               ng_v[0][i],
-                                                               omega_v[0][i],
-                                                               cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == sg_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDSaturationGas(phi_v[0][i],
-                                                             sl_v[0][i],
-                                                             nl_v[0][i],
-                                                             si_v[0][i],
-                                                             ni_v[0][i],
-                                                             sg_v[0][i],
-                                                             ng_v[0][i],
-                                                             omega_v[0][i],
-                                                             cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == ng_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDMolarDensityGas(phi_v[0][i],
-                                                               sl_v[0][i],
-                                                               nl_v[0][i],
-                                                               si_v[0][i],
-                                                               ni_v[0][i],
-                                                               sg_v[0][i],
-                                                               ng_v[0][i],
-                                                               omega_v[0][i],
-                                                               cv_v[0][i]);
-      }
-    }
+  const std::array<const Key*, 9> wrt_keys = { &phi_key_, &sl_key_, &nl_key_, &si_key_, &ni_key_, &sg_key_, &ng_key_, &omega_key_, &cv_key_ };
+  std::size_t k = 0;
+  while (k != wrt_keys.size() && *wrt_keys[k] != wrt_key) ++k;
+  AMANZI_ASSERT(k != wrt_keys.size());
+
+  // The DAG requests one partial at a time, but they share subexpressions, so
+  // every partial requested so far is computed in a single pass on the first
+  // request after Evaluate_() and then served from partials_.  Partials that
+  // are never requested are neither allocated nor computed.
+  if (partials_.size() != wrt_keys.size()) partials_.resize(wrt_keys.size());
+  if (partials_[k] == Teuchos::null) {
+    partials_[k] = Teuchos::rcp(new CompositeVector(result[0]->Map()));
+    partials_valid_ = false;
+  }
 
-  } else if (wrt_key == omega_key_) {
+  if (!partials_valid_) {
     for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
          ++comp) {
       const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
@@ -355,53 +197,40 @@ ThreePhaseWaterContentEvaluator::EvaluatePartialDerivative_(
       const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
       const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
       const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDMolFracGas(phi_v[0][i],
-                                                          sl_v[0][i],
-                                                          nl_v[0][i],
-                                                          si_v[0][i],
-                                                          ni_v[0][i],
-                                                          sg_v[0][i],
-                                                          ng_v[0][i],
-                                                          omega_v[0][i],
-                                                          cv_v[0][i]);
+      std::array<Epetra_MultiVector*, 9> d_v;
+      for (std::size_t j = 0; j != d_v.size(); ++j) {
+        d_v[j] =
+          partials_[j] == Teuchos::null ? nullptr : partials_[j]->ViewComponent(*comp, false).get();
       }
-    }
-
-  } else if (wrt_key == cv_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
+      std::array<double*, 9> d;
 
       int ncomp = result[0]->size(*comp, false);
       for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDCellVolume(phi_v[0][i],
-                                                          sl_v[0][i],
-                                                          nl_v[0][i],
-                                                          si_v[0][i],
-                                                          ni_v[0][i],
-                                                          sg_v[0][i],
-                                                          ng_v[0][i],
-                                                          omega_v[0][i],
-                                                          cv_v[0][i]);
+        for (std::size_t j = 0; j != d.size(); ++j) d[j] = d_v[j] ? &(*d_v[j])[0][i] : nullptr;
+        model_->WaterContentAndDerivatives(phi_v[0][i],
+                                           sl_v[0][i],
+                                           nl_v[0][i],
+                                           si_v[0][i],
+                                           ni_v[0][i],
+                                           sg_v[0][i],
+                                           ng_v[0][i],
+                                           omega_v[0][i],
+                                           cv_v[0][i],
+                                           d[0],
+                                           d[1],
+                                           d[2],
+                                           d[3],
+                                           d[4],
+                                           d[5],
+                                           d[6],
+                                           d[7],
+                                           d[8]);
       }
     }
-
-  } else {
-    AMANZI_ASSERT(0);
+    partials_valid_ = true;
   }
+
+  *result[0] = *partials_[k];
 }
 
 
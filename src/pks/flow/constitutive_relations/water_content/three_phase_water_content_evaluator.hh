@@ -47,7 +47,7 @@ class ThreePhaseWaterContentModel;
 class ThreePhaseWaterContentEvaluator : public EvaluatorSecondaryMonotypeCV {
  public:
   explicit ThreePhaseWaterContentEvaluator(Teuchos::ParameterList& plist);
-  ThreePhaseWaterContentEvaluator(const ThreePhaseWaterContentEvaluator& other) = default;
+  ThreePhaseWaterContentEvaluator(const ThreePhaseWaterContentEvaluator& other);
 
   virtual Teuchos::RCP<Evaluator> Clone() const override;
 
@@ -77,6 +77,12 @@ class ThreePhaseWaterContentEvaluator : public EvaluatorSecondaryMonotypeCV {
 
   Teuchos::RCP<ThreePhaseWaterContentModel> model_;
 
+  // partial derivatives with respect to each dependency, in the order above,
+  // null until first requested, and recomputed together on the first
+  // request after the value is updated
+  std::vector<Teuchos::RCP<CompositeVector>> partials_;
+  bool partials_valid_;
+
  private:
   static Utils::RegisteredFactory<Evaluator, ThreePhaseWaterContentEvaluator> reg_;
 };
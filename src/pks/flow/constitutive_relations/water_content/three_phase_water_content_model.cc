@@ -51,6 +51,44 @@ ThreePhaseWaterContentModel::WaterContent(double phi,
   return cv * phi * (ng * omega * sg + ni * si + nl * sl);
 }
 
+// value and all partials in one pass
+double
+ThreePhaseWaterContentModel::WaterContentAndDerivatives(double phi,
+                                                        double sl,
+                                                        double nl,
+                                                        double si,
+                                                        double ni,
+                                                        double sg,
+                                                        double ng,
+                                                        double omega,
+                                                        double cv,
+                                                        double* d_phi,
+                                                        double* d_sl,
+                                                        double* d_nl,
+                                                        double* d_si,
+                                                        double* d_ni,
+                                                        double* d_sg,
+                                                        double* d_ng,
+                                                        double* d_omega,
+                                                        double* d_cv) const
+{
+  double x0 = ng * omega;
+  double x1 = ni * si + nl * sl + sg * x0;
+  double x2 = cv * x1;
+  double x3 = cv * phi;
+  double x4 = sg * x3;
+  if (d_phi) *d_phi = x2;
+  if (d_sl) *d_sl = nl * x3;
+  if (d_nl) *d_nl = sl * x3;
+  if (d_si) *d_si = ni * x3;
+  if (d_ni) *d_ni = si * x3;
+  if (d_sg) *d_sg = x0 * x3;
+  if (d_ng) *d_ng = omega * x4;
+  if (d_omega) *d_omega = ng * x4;
+  if (d_cv) *d_cv = phi * x1;
+  return phi * x2;
+}
+
 double
 ThreePhaseWaterContentModel::DWaterContentDPorosity(double phi,
                                                     double sl,
@@ -36,6 +36,46 @@ class ThreePhaseWaterContentModel {
                       double omega,
                       double cv) const;
 
+  // Array kernel over n contiguous cells, inline to allow vectorization.
+  void WaterContent(int n,
+                    const double* __restrict__ phi,
+                    const double* __restrict__ sl,
+                    const double* __restrict__ nl,
+                    const double* __restrict__ si,
+                    const double* __restrict__ ni,
+                    const double* __restrict__ sg,
+                    const double* __restrict__ ng,
+                    const double* __restrict__ omega,
+                    const double* __restrict__ cv,
+                    double* __restrict__ result) const
+  {
+#pragma omp simd
+    for (int i = 0; i < n; ++i) {
+      result[i] = cv[i] * phi[i] * (ng[i] * omega[i] * sg[i] + ni[i] * si[i] + nl[i] * sl[i]);
+    }
+  }
+
+  // Computes the value and, for each non-null pointer, the partial derivative
+  // with respect to that dependency, sharing common subexpressions.
+  double WaterContentAndDerivatives(double phi,
+                                    double sl,
+                                    double nl,
+                                    double si,
+                                    double ni,
+                                    double sg,
+                                    double ng,
+                                    double omega,
+                                    double cv,
+                                    double* d_phi,
+                                    double* d_sl,
+                                    double* d_nl,
+                                    double* d_si,
+                                    double* d_ni,
+                                    double* d_sg,
+                                    double* d_ng,
+                                    double* d_omega,
+                                    double* d_cv) const;
+
   double DWaterContentDPorosity(double phi,
                                 double sl,
                                 double nl,
@@ -0,0 +1,158 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+// Checks the per-point, warm-started and tabulated solves of
+// WRMImplicitPermafrostModel against its default, cold bisection.
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "wrm_van_genuchten.hh"
+#include "wrm_implicit_permafrost_model.hh"
+#include "pc_ice_water.hh"
+
+using namespace Amanzi::Flow;
+
+namespace {
+
+struct ImplicitPermafrostProblem {
+  ImplicitPermafrostProblem()
+  {
+    Teuchos::ParameterList wrm_list;
+    wrm_list.set("van Genuchten alpha [Pa^-1]", 1.5e-4);
+    wrm_list.set("van Genuchten m [-]", 0.8);
+    wrm_list.set("residual saturation [-]", 0.);
+    wrm = Teuchos::rcp(new WRMVanGenuchten(wrm_list));
+
+    // unsaturated and frozen, from just below freezing to well below, and
+    // from the splined region to dry
+    Teuchos::ParameterList pc_list;
+    PCIceWater pcice(pc_list);
+    int n = 60;
+    for (int i = 0; i != n; ++i) {
+      pc_liq.push_back(std::pow(10., 2. + 4. * i / (n - 1)));
+      pc_ice.push_back(pcice.CapillaryPressure(273.1 - 5. * ((7 * i) % n) / n, 1000.));
+    }
+  }
+
+  Teuchos::RCP<WRMImplicitPermafrostModel> createModel(Teuchos::ParameterList& plist)
+  {
+    auto model = Teuchos::rcp(new WRMImplicitPermafrostModel(plist));
+    model->set_WRM(wrm);
+    return model;
+  }
+
+  // Evaluates as the evaluator does, in separate passes over all points, and
+  // checks against the default model evaluated point by point.
+  void checkPasses(WRMImplicitPermafrostModel& model, double sat_tol, bool check_derivs)
+  {
+    Teuchos::ParameterList plist;
+    auto baseline = createModel(plist);
+    int n = pc_liq.size();
+    std::vector<double> sats(3 * n), dsats_liq(3 * n), dsats_ice(3 * n);
+    double vals[3];
+    for (int i = 0; i != n; ++i) {
+      model.saturations_at(i, pc_liq[i], pc_ice[i], vals);
+      std::copy(vals, vals + 3, &sats[3 * i]);
+    }
+    for (int i = 0; i != n; ++i) {
+      model.dsaturations_dpc_liq_at(i, pc_liq[i], pc_ice[i], vals);
+      std::copy(vals, vals + 3, &dsats_liq[3 * i]);
+    }
+    for (int i = 0; i != n; ++i) {
+      model.dsaturations_dpc_ice_at(i, pc_liq[i], pc_ice[i], vals);
+      std::copy(vals, vals + 3, &dsats_ice[3 * i]);
+    }
+
+    for (int i = 0; i != n; ++i) {
+      double expected[3];
+      baseline->saturations(pc_liq[i], pc_ice[i], expected);
+      for (int k = 0; k != 3; ++k) CHECK_CLOSE(expected[k], sats[3 * i + k], sat_tol);
+      if (!check_derivs) continue;
+
+      // Near zero, dsi/dpc_liq is regularized to +-1.e-10, with the sign of
+      // round-off in s_i.
+      baseline->dsaturations_dpc_liq(pc_liq[i], pc_ice[i], expected);
+      for (int k = 0; k != 3; ++k) {
+        CHECK_CLOSE(expected[k], dsats_liq[3 * i + k], 1.e-6 * std::abs(expected[k]) + 3.e-10);
+      }
+      baseline->dsaturations_dpc_ice(pc_liq[i], pc_ice[i], expected);
+      for (int k = 0; k != 3; ++k) {
+        CHECK_CLOSE(expected[k], dsats_ice[3 * i + k], 1.e-6 * std::abs(expected[k]) + 1.e-14);
+      }
+    }
+  }
+
+  // moves every point, as between nonlinear iterations
+  void perturb(double factor)
+  {
+    for (auto& pc : pc_liq) pc *= factor;
+    for (auto& pc : pc_ice) pc *= 2. - factor;
+  }
+
+  Teuchos::RCP<WRMVanGenuchten> wrm;
+  std::vector<double> pc_liq, pc_ice;
+};
+
+} // namespace
+
+
+SUITE(IMPLICIT_PERMAFROST_SOLVE)
+{
+  // Reusing the solve at each point returns the same values as solving for
+  // every call.
+  TEST_FIXTURE(ImplicitPermafrostProblem, PER_POINT_REUSE)
+  {
+    Teuchos::ParameterList plist;
+    auto model = createModel(plist);
+    checkPasses(*model, 1.e-10, true);
+    perturb(1.01);
+    checkPasses(*model, 1.e-10, true);
+  }
+
+  // Warm starting from the last solve at each point converges to the same
+  // root, both when it brackets the root and when it falls back to [0,1].
+  TEST_FIXTURE(ImplicitPermafrostProblem, WARM_START)
+  {
+    Teuchos::ParameterList plist;
+    plist.set("warm start implicit solve", true);
+    auto model = createModel(plist);
+    checkPasses(*model, 1.e-10, true);
+    perturb(1.001);
+    checkPasses(*model, 1.e-10, true);
+    perturb(1.5);
+    checkPasses(*model, 1.e-10, true);
+  }
+
+  TEST_FIXTURE(ImplicitPermafrostProblem, WARM_START_TOMS)
+  {
+    Teuchos::ParameterList plist;
+    plist.set("warm start implicit solve", true);
+    plist.set("solver algorithm [bisection/toms]", "toms");
+    auto model = createModel(plist);
+    checkPasses(*model, 1.e-10, true);
+    perturb(1.001);
+    checkPasses(*model, 1.e-10, true);
+  }
+
+  // The table is only used where its sampled error is within tolerance, so
+  // saturations agree to about that tolerance.
+  TEST_FIXTURE(ImplicitPermafrostProblem, TABLE)
+  {
+    Teuchos::ParameterList plist;
+    plist.set("tabulate ice saturation", true);
+    plist.set("table tolerance", 1.e-6);
+    auto model = createModel(plist);
+    checkPasses(*model, 1.e-5, false);
+    perturb(1.01);
+    checkPasses(*model, 1.e-5, false);
+  }
+}
@@ -32,6 +32,23 @@ WRMImplicitPermafrostModel::WRMImplicitPermafrostModel(Teuchos::ParameterList& p
   max_it_ = plist_.get<int>("max iterations", 100);
   deriv_regularization_ = plist_.get<double>("minimum dsi_dpressure magnitude", 1.e-10);
   solver_ = plist_.get<std::string>("solver algorithm [bisection/toms]", "bisection");
+  if (solver_ != "bisection" && solver_ != "toms") {
+    Errors::Message emsg;
+    emsg << "WRMImplicitPermafrostModel: unknown \"solver algorithm [bisection/toms]\" \""
+         << solver_ << "\"";
+    Exceptions::amanzi_throw(emsg);
+  }
+  toms_ = solver_ == "toms";
+
+  point_ = -1;
+  warm_start_ = plist_.get<bool>("warm start implicit solve", false);
+
+  tabulate_ = plist_.get<bool>("tabulate ice saturation", false);
+  table_log_min_ = std::log10(plist_.get<double>("table minimum capillary pressure [Pa]", 1.));
+  table_log_max_ = std::log10(plist_.get<double>("table maximum capillary pressure [Pa]", 1.e8));
+  table_ppd_ = plist_.get<int>("table points per decade", 20);
+  table_tol_ = plist_.get<double>("table tolerance", 1.e-6);
+  table_n_ = 0;
 }
 
 // Above freezing calculation methods:
@@ -183,24 +200,7 @@ WRMImplicitPermafrostModel::dsats_dpc_ice_frozen_unsaturated_(double pc_liq,
 double
 WRMImplicitPermafrostModel::si_frozen_unsaturated_(double pc_liq, double pc_ice)
 {
-  double si(0.);
-
-  // check if we are in the splined region
-  double cutoff(0.), si_cutoff(0.);
-  DetermineSplineCutoff_(pc_liq, pc_ice, cutoff, si_cutoff);
-  if (pc_liq > cutoff) {
-    // outside of the spline
-    si = si_frozen_unsaturated_nospline_(pc_liq, pc_ice);
-  } else {
-    // fit spline, evaluate
-    double spline[4];
-    FitSpline_(pc_ice, cutoff, si_cutoff, spline);
-    si = ((spline[0] * pc_liq + spline[1]) * pc_liq + spline[2]) * pc_liq + spline[3];
-    si = std::max(si, 0.);
-    AMANZI_ASSERT(si <= 1.);
-  }
-
-  return si;
+  return Solve_(pc_liq, pc_ice).si;
 }
 
 
@@ -208,18 +208,14 @@ WRMImplicitPermafrostModel::si_frozen_unsaturated_(double pc_liq, double pc_ice)
 double
 WRMImplicitPermafrostModel::dsi_dpc_liq_frozen_unsaturated_(double pc_liq, double pc_ice, double si)
 {
-  // check if we are in the splined region
-  double cutoff(0.), si_cutoff(0.);
+  const PointSolve_& sol = Solve_(pc_liq, pc_ice);
   double dsi(0.);
-
-  DetermineSplineCutoff_(pc_liq, pc_ice, cutoff, si_cutoff);
-  if (pc_liq > cutoff) {
+  if (!sol.splined) {
     // outside of the spline
     dsi = dsi_dpc_liq_frozen_unsaturated_nospline_(pc_liq, pc_ice, si);
   } else {
-    // fit spline, evaluate
-    double spline[4];
-    FitSpline_(pc_ice, cutoff, si_cutoff, spline);
+    // evaluate the spline
+    const double* spline = sol.coefs;
     dsi = (3 * spline[0] * pc_liq + 2 * spline[1]) * pc_liq + spline[2];
   }
 
@@ -235,21 +231,20 @@ WRMImplicitPermafrostModel::dsi_dpc_liq_frozen_unsaturated_(double pc_liq, doubl
 double
 WRMImplicitPermafrostModel::dsi_dpc_ice_frozen_unsaturated_(double pc_liq, double pc_ice, double si)
 {
-  // check if we are in the splined region
-  double cutoff(0.), si_cutoff(0.);
-  DetermineSplineCutoff_(pc_liq, pc_ice, cutoff, si_cutoff);
-  if (pc_liq > cutoff) {
+  const PointSolve_& sol = Solve_(pc_liq, pc_ice);
+  if (!sol.splined) {
     // outside of the spline
     return dsi_dpc_ice_frozen_unsaturated_nospline_(pc_liq, pc_ice, si);
   } else {
-    // fit two splines, difference neighboring splines
-    double spline1[4], spline2[4];
-    FitSpline_(pc_ice, cutoff, si_cutoff, spline1);
+    // fit a second spline, difference neighboring splines
+    const double* spline1 = sol.coefs;
+    double cutoff = sol.cutoff;
+    double spline2[4];
 
     double delta_pc_ice = std::max(.1, pc_ice / 100.);
 
     double pc_ice2 = pc_ice + delta_pc_ice;
-    double si_cutoff2 = si_frozen_unsaturated_nospline_(cutoff, pc_ice2);
+    double si_cutoff2 = si_frozen_unsaturated_nospline_(cutoff, pc_ice2, false, sol.si_cutoff);
     FitSpline_(pc_ice2, cutoff, si_cutoff2, spline2);
 
     double dspline[4];
@@ -263,20 +258,66 @@ WRMImplicitPermafrostModel::dsi_dpc_ice_frozen_unsaturated_(double pc_liq, doubl
 }
 
 
+// -- Solve at a point, unless this is the last point solved, or the caller
+//    gave a point index and that point was last solved at the same pressures.
+//    Saturation and its two derivatives are evaluated in separate passes over
+//    all points, so each point is typically needed three times.
+const WRMImplicitPermafrostModel::PointSolve_&
+WRMImplicitPermafrostModel::Solve_(double pc_liq, double pc_ice)
+{
+  PointSolve_* sol = &last_solve_;
+  if (point_ >= 0) {
+    if (point_ >= (int)point_solves_.size()) point_solves_.resize(point_ + 1);
+    sol = &point_solves_[point_];
+  }
+  if (sol->pc_liq == pc_liq && sol->pc_ice == pc_ice) return *sol;
+
+  // the last solve here, if any, is the warm start
+  PointSolve_ previous = *sol;
+  bool has_previous = sol->pc_liq >= 0.;
+  sol->pc_liq = -1.;
+
+  // check if we are in the splined region
+  DetermineSplineCutoff_(
+    pc_liq, pc_ice, sol->cutoff, sol->si_cutoff, has_previous ? &previous : nullptr);
+  sol->splined = pc_liq <= sol->cutoff;
+  if (!sol->splined) {
+    // outside of the spline
+    sol->si =
+      si_frozen_unsaturated_nospline_(pc_liq, pc_ice, false, has_previous ? previous.si : -1.);
+  } else {
+    // fit spline, evaluate
+    FitSpline_(pc_ice, sol->cutoff, sol->si_cutoff, sol->coefs);
+    const double* spline = sol->coefs;
+    sol->si = ((spline[0] * pc_liq + spline[1]) * pc_liq + spline[2]) * pc_liq + spline[3];
+    sol->si = std::max(sol->si, 0.);
+    AMANZI_ASSERT(sol->si <= 1.);
+  }
+
+  // only now is it a valid entry
+  sol->pc_liq = pc_liq;
+  sol->pc_ice = pc_ice;
+  return *sol;
+}
+
+
 // Helper methods for spline
 // -- Determine the point beyond which the spline is not needed
 bool
 WRMImplicitPermafrostModel::DetermineSplineCutoff_(double pc_liq,
                                                    double pc_ice,
                                                    double& cutoff,
-                                                   double& si)
+                                                   double& si,
+                                                   const PointSolve_* previous)
 {
   cutoff = std::exp(std::floor(std::log(pc_liq)));
   bool done(false);
   while (!done) {
+    // warm start from the previous solve at this cutoff, if any
+    double si_guess = previous && previous->cutoff == cutoff ? previous->si_cutoff : -1.;
     try {
       si = si_frozen_unsaturated_nospline_(
-        cutoff, pc_ice, true); // use the version that throws on error
+        cutoff, pc_ice, true, si_guess); // use the version that throws on error
     } catch (const Errors::CutTimeStep& e) {
       cutoff = std::exp(std::log(cutoff) + 1.);
       continue;
@@ -347,24 +388,54 @@ WRMImplicitPermafrostModel::FitSpline_(double pc_ice,
 double
 WRMImplicitPermafrostModel::si_frozen_unsaturated_nospline_(double pc_liq,
                                                             double pc_ice,
-                                                            bool throw_ok)
+                                                            bool throw_ok,
+                                                            double si_guess)
+{
+  double si(0.);
+  // The spline cutoff search relies on the solve's convergence, so it never
+  // uses the table.
+  if (tabulate_ && !throw_ok && TableLookup_(pc_liq, pc_ice, si)) return si;
+
+  if (!SolveNoSpline_(pc_liq, pc_ice, si, si_guess)) {
+    SatIceFunctor_ func(pc_liq, pc_ice, wrm_);
+    std::cout << "WRMImplicitPermafrostModel did not converge, error = " << func(si)
+              << ", s_i = " << si << ", PC_{lg,il} = " << pc_liq << "," << pc_ice << std::endl;
+    if (throw_ok) { Exceptions::amanzi_throw(Errors::CutTimeStep()); }
+  }
+  return si;
+}
+
+
+// -- solve the implicit equation for si
+bool
+WRMImplicitPermafrostModel::SolveNoSpline_(double pc_liq,
+                                           double pc_ice,
+                                           double& si,
+                                           double si_guess)
 {
-  // solve implicit equation for s_i
   SatIceFunctor_ func(pc_liq, pc_ice, wrm_);
   Tol_ tol(eps_);
   boost::uintmax_t max_it(max_it_);
   double left = 0.;
   double right = 1.;
 
+  // try a bracket about the guess first
+  if (warm_start_ && si_guess >= 0.) {
+    double width = 1.e-2;
+    double wleft = std::max(si_guess - width, 0.);
+    double wright = std::min(si_guess + width, 1.);
+    if (func(wleft) * func(wright) <= 0.) {
+      left = wleft;
+      right = wright;
+    }
+  }
+
   std::pair<double, double> result;
   try {
-    if (solver_ == "bisection") {
-      result = boost::math::tools::bisect(func, left, right, tol, max_it);
-    } else if (solver_ == "toms") {
+    if (toms_) {
       result = boost::math::tools::toms748_solve(func, left, right, tol, max_it);
     } else {
-      Errors::Message emsg("Unknown solver method");
-      Exceptions::amanzi_throw(emsg);
+      result = boost::math::tools::bisect(func, left, right, tol, max_it);
     }
   } catch (const std::exception& e) {
     // this throw should not be caught
@@ -374,19 +445,85 @@ WRMImplicitPermafrostModel::si_frozen_unsaturated_nospline_(double pc_liq,
     Exceptions::amanzi_throw(emsg);
   }
 
-  double si = (result.first + result.second) / 2.;
+  si = (result.first + result.second) / 2.;
   AMANZI_ASSERT(0. <= si && si <= 1.);
 
-  if (max_it >= max_it_) {
-    // did not converge?  May be ABS converged but not REL converged!
-    if (!tol(func(si), 0.)) {
-      std::cout << "WRMImplicitPermafrostModel did not converge, " << max_it
-                << " iterations, error = " << func(si) << ", s_i = " << si
-                << ", PC_{lg,il} = " << pc_liq << "," << pc_ice << std::endl;
-      if (throw_ok) { Exceptions::amanzi_throw(Errors::CutTimeStep()); }
+  // did not converge?  May be ABS converged but not REL converged!
+  return max_it < max_it_ || tol(func(si), 0.);
+}
+
+
+// -- Build the table of si, checking the interpolation error at the center
+//    and edge midpoints of each table cell.
+void
+WRMImplicitPermafrostModel::BuildTable_()
+{
+  int n = std::max(
+    (int)std::ceil((table_log_max_ - table_log_min_) * table_ppd_), 1); // number of table cells
+  table_n_ = n;
+  double dlog = (table_log_max_ - table_log_min_) / n;
+  auto pc = [&](double k) { return std::pow(10., table_log_min_ + k * dlog); };
+  auto node = [&](int i, int j) { return table_[i * (n + 1) + j]; };
+
+  // Solves not converged mark a node as NaN, which fails any check below.
+  table_.resize((n + 1) * (n + 1));
+  for (int i = 0; i != n + 1; ++i) {
+    for (int j = 0; j != n + 1; ++j) {
+      double si;
+      table_[i * (n + 1) + j] = SolveNoSpline_(pc(i), pc(j), si) ? si : std::nan("");
+    }
+  }
+
+  // Checks linear interpolation between nodes at a midpoint.  Edges are
+  // shared by neighboring table cells, so each is checked once.
+  auto check = [&](double pc_liq, double pc_ice, double interp) {
+    double si;
+    return SolveNoSpline_(pc_liq, pc_ice, si) && std::abs(interp - si) <= table_tol_;
+  };
+  std::vector<bool> liq_edge_ok(n * (n + 1)); // edges along pc_liq, (i + 1/2, j)
+  std::vector<bool> ice_edge_ok((n + 1) * n); // edges along pc_ice, (i, j + 1/2)
+  for (int i = 0; i != n + 1; ++i) {
+    for (int j = 0; j != n + 1; ++j) {
+      if (i < n)
+        liq_edge_ok[i * (n + 1) + j] =
+          check(pc(i + 0.5), pc(j), 0.5 * (node(i, j) + node(i + 1, j)));
+      if (j < n)
+        ice_edge_ok[i * n + j] = check(pc(i), pc(j + 0.5), 0.5 * (node(i, j) + node(i, j + 1)));
+    }
+  }
+
+  table_ok_.resize(n * n);
+  for (int i = 0; i != n; ++i) {
+    for (int j = 0; j != n; ++j) {
+      double interp = 0.25 * (node(i, j) + node(i + 1, j) + node(i, j + 1) + node(i + 1, j + 1));
+      table_ok_[i * n + j] = liq_edge_ok[i * (n + 1) + j] && liq_edge_ok[i * (n + 1) + j + 1] &&
+                             ice_edge_ok[i * n + j] && ice_edge_ok[(i + 1) * n + j] &&
+                             check(pc(i + 0.5), pc(j + 0.5), interp);
     }
   }
-  return si;
+}
+
+
+// -- Interpolate si from the table, returning false if not tabulated here.
+bool
+WRMImplicitPermafrostModel::TableLookup_(double pc_liq, double pc_ice, double& si)
+{
+  if (table_n_ == 0) BuildTable_();
+  int n = table_n_;
+  double scale = n / (table_log_max_ - table_log_min_);
+  double x = (std::log10(pc_liq) - table_log_min_) * scale;
+  double y = (std::log10(pc_ice) - table_log_min_) * scale;
+  if (!(x >= 0. && x < n && y >= 0. && y < n)) return false;
+
+  int i = (int)x;
+  int j = (int)y;
+  if (!table_ok_[i * n + j]) return false;
+
+  double fx = x - i;
+  double fy = y - j;
+  si = (1 - fx) * ((1 - fy) * table_[i * (n + 1) + j] + fy * table_[i * (n + 1) + j + 1]) +
+       fx * ((1 - fy) * table_[(i + 1) * (n + 1) + j] + fy * table_[(i + 1) * (n + 1) + j + 1]);
+  return true;
 }
 
 
@@ -455,5 +592,36 @@ WRMImplicitPermafrostModel::dsaturations_dpc_ice(double pc_liq, double pc_ice, d
 };
 
 
+void
+WRMImplicitPermafrostModel::saturations_at(int i, double pc_liq, double pc_ice, double (&sats)[3])
+{
+  point_ = i;
+  saturations(pc_liq, pc_ice, sats);
+  point_ = -1;
+}
+
+void
+WRMImplicitPermafrostModel::dsaturations_dpc_liq_at(int i,
+                                                    double pc_liq,
+                                                    double pc_ice,
+                                                    double (&dsats)[3])
+{
+  point_ = i;
+  dsaturations_dpc_liq(pc_liq, pc_ice, dsats);
+  point_ = -1;
+}
+
+void
+WRMImplicitPermafrostModel::dsaturations_dpc_ice_at(int i,
+                                                    double pc_liq,
+                                                    double pc_ice,
+                                                    double (&dsats)[3])
+{
+  point_ = i;
+  dsaturations_dpc_ice(pc_liq, pc_ice, dsats);
+  point_ = -1;
+}
+
+
 } // namespace Flow
 } // namespace Amanzi
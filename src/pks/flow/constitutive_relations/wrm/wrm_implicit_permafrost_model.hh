@@ -16,12 +16,31 @@
     * `"converged tolerance`" ``[double]`` **1.e-12** Convergence tolerance of the implicit solve.
     * `"max iterations`" ``[int]`` **100** Maximum allowable iterations of the implicit solve.
     * `"solver algorithm [bisection/toms]`" ``[string]`` **bisection** Use bisection or the TOMS algorithm from boost.
+    * `"warm start implicit solve`" ``[bool]`` **false** Bracket each solve
+      first around the previous solution at the same cell, falling back to
+      [0,1] if that does not contain the root.  Results agree to the
+      converged tolerance.
+    * `"tabulate ice saturation`" ``[bool]`` **false** Replace the implicit
+      solve, outside of the splined region, by bilinear interpolation in a
+      table over log10 of both capillary pressures.  Each table cell is used
+      only if the solve converged at its corners and interpolation at its
+      center and edge midpoints is within `"table tolerance`" of the solve;
+      elsewhere, and outside the table, the solve is used.  This samples the
+      error rather than bounding it, so use a tolerance with some margin.
+    * `"table minimum capillary pressure [Pa]`" ``[double]`` **1** Lower
+      bound of both table axes.
+    * `"table maximum capillary pressure [Pa]`" ``[double]`` **1.e8** Upper
+      bound of both table axes.
+    * `"table points per decade`" ``[int]`` **20**
+    * `"table tolerance`" ``[double]`` **1.e-6** Allowed error in s_i.
 
 */
 
 #ifndef AMANZI_FLOWRELATIONS_WRM_IMPLICIT_PERMAFROST_MODEL_
 #define AMANZI_FLOWRELATIONS_WRM_IMPLICIT_PERMAFROST_MODEL_
 
+#include <vector>
+
 #include "boost/cstdint.hpp"
 #include "boost/math/tools/roots.hpp"
 #include "boost/cstdint.hpp"
@@ -45,7 +64,25 @@ class WRMImplicitPermafrostModel : public WRMPermafrostModel {
   virtual void dsaturations_dpc_liq(double pc_liq, double pc_ice, double (&dsats)[3]);
   virtual void dsaturations_dpc_ice(double pc_liq, double pc_ice, double (&dsats)[3]);
 
+  // The last implicit solve at each point is kept, so that the saturation and
+  // its derivatives at a point, which are evaluated in separate passes over
+  // all points, solve only once.
+  virtual void saturations_at(int i, double pc_liq, double pc_ice, double (&sats)[3]);
+  virtual void dsaturations_dpc_liq_at(int i, double pc_liq, double pc_ice, double (&dsats)[3]);
+  virtual void dsaturations_dpc_ice_at(int i, double pc_liq, double pc_ice, double (&dsats)[3]);
+
  protected:
+  // The solution at one point: ice saturation, the spline cutoff, and, if
+  // pc_liq is within the splined region, the spline.
+  struct PointSolve_ {
+    double pc_liq = -1.;
+    double pc_ice = -1.;
+    double si;
+    double cutoff, si_cutoff;
+    bool splined;
+    double coefs[4];
+  };
+
   // calculation if unfrozen
   bool sats_unfrozen_(double pc_liq, double pc_ice, double (&sats)[3]);
   bool dsats_dpc_liq_unfrozen_(double pc_liq, double pc_ice, double (&dsats)[3]);
@@ -65,19 +102,55 @@ class WRMImplicitPermafrostModel : public WRMPermafrostModel {
   double dsi_dpc_liq_frozen_unsaturated_(double pc_liq, double pc_ice, double si);
   double dsi_dpc_ice_frozen_unsaturated_(double pc_liq, double pc_ice, double si);
 
-  double si_frozen_unsaturated_nospline_(double pc_liq, double pc_ice, bool throw_ok = false);
+  double si_frozen_unsaturated_nospline_(double pc_liq,
+                                         double pc_ice,
+                                         bool throw_ok = false,
+                                         double si_guess = -1.);
   double dsi_dpc_liq_frozen_unsaturated_nospline_(double pc_liq, double pc_ice, double si);
   double dsi_dpc_ice_frozen_unsaturated_nospline_(double pc_liq, double pc_ice, double si);
 
-  bool DetermineSplineCutoff_(double pc_liq, double pc_ice, double& cutoff, double& si);
+  bool DetermineSplineCutoff_(double pc_liq,
+                              double pc_ice,
+                              double& cutoff,
+                              double& si,
+                              const PointSolve_* previous = nullptr);
   bool FitSpline_(double pc_ice, double cutoff, double si_cutoff, double (&coefs)[4]);
 
+  // Solves at a point, unless already solved there.
+  const PointSolve_& Solve_(double pc_liq, double pc_ice);
+
+  // Solves the implicit equation, returning false if not converged.  If warm
+  // starting, a nonnegative si_guess is tried first.
+  bool SolveNoSpline_(double pc_liq, double pc_ice, double& si, double si_guess = -1.);
+
+  void BuildTable_();
+  bool TableLookup_(double pc_liq, double pc_ice, double& si);
+
 
  protected:
   double eps_;
   boost::uintmax_t max_it_;
   double deriv_regularization_;
   std::string solver_;
+  bool toms_;
+
+  // the last solve at each point, and at the current point, or -1 if the
+  // caller gave none
+  std::vector<PointSolve_> point_solves_;
+  PointSolve_ last_solve_;
+  int point_;
+
+  bool warm_start_;
+
+  // table of s_i over (log10 pc_liq, log10 pc_ice), row-major in pc_liq,
+  // with a flag per table cell of whether it meets the tolerance
+  bool tabulate_;
+  double table_log_min_, table_log_max_;
+  int table_ppd_;
+  double table_tol_;
+  int table_n_;
+  std::vector<double> table_;
+  std::vector<bool> table_ok_;
 
  private:
   // Functor for ice saturation, gets used within a root-finding algorithm
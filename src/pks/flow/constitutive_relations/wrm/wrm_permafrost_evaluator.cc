@@ -161,7 +161,7 @@ WRMPermafrostEvaluator::Evaluate_(const State& S, const std::vector<CompositeVec
   int ncells = satg_c.MyLength();
   for (AmanziMesh::Entity_ID c = 0; c != ncells; ++c) {
     int i = (*permafrost_models_->first)[c];
-    permafrost_models_->second[i]->saturations(pc_liq_c[0][c], pc_ice_c[0][c], sats);
+    permafrost_models_->second[i]->saturations_at(c, pc_liq_c[0][c], pc_ice_c[0][c], sats);
     satg_c[0][c] = sats[0];
     satl_c[0][c] = sats[1];
     sati_c[0][c] = sats[2];
@@ -192,7 +192,8 @@ WRMPermafrostEvaluator::Evaluate_(const State& S, const std::vector<CompositeVec
       AMANZI_ASSERT(cells.size() == 1);
 
       int i = (*permafrost_models_->first)[cells[0]];
-      permafrost_models_->second[i]->saturations(pc_liq_bf[0][bf], pc_ice_bf[0][bf], sats);
+      permafrost_models_->second[i]->saturations_at(
+        ncells + bf, pc_liq_bf[0][bf], pc_ice_bf[0][bf], sats);
       satg_bf[0][bf] = sats[0];
       satl_bf[0][bf] = sats[1];
       sati_bf[0][bf] = sats[2];
@@ -225,11 +226,12 @@ WRMPermafrostEvaluator::EvaluatePartialDerivative_(const State& S,
     *S.GetPtr<CompositeVector>(pc_ice_key_, tag)->ViewComponent("cell", false);
 
   double dsats[3];
+  int ncells = satg_c.MyLength();
   if (wrt_key == pc_liq_key_) {
-    int ncells = satg_c.MyLength();
     for (AmanziMesh::Entity_ID c = 0; c != ncells; ++c) {
       int i = (*permafrost_models_->first)[c];
-      permafrost_models_->second[i]->dsaturations_dpc_liq(pc_liq_c[0][c], pc_ice_c[0][c], dsats);
+      permafrost_models_->second[i]->dsaturations_dpc_liq_at(
+        c, pc_liq_c[0][c], pc_ice_c[0][c], dsats);
 
       satg_c[0][c] = dsats[0];
       satl_c[0][c] = dsats[1];
@@ -237,10 +239,10 @@ WRMPermafrostEvaluator::EvaluatePartialDerivative_(const State& S,
     }
 
   } else if (wrt_key == pc_ice_key_) {
-    int ncells = satg_c.MyLength();
     for (AmanziMesh::Entity_ID c = 0; c != ncells; ++c) {
       int i = (*permafrost_models_->first)[c];
-      permafrost_models_->second[i]->dsaturations_dpc_ice(pc_liq_c[0][c], pc_ice_c[0][c], dsats);
+      permafrost_models_->second[i]->dsaturations_dpc_ice_at(
+        c, pc_liq_c[0][c], pc_ice_c[0][c], dsats);
 
       satg_c[0][c] = dsats[0];
       satl_c[0][c] = dsats[1];
@@ -276,8 +278,8 @@ WRMPermafrostEvaluator::EvaluatePartialDerivative_(const State& S,
         AMANZI_ASSERT(cells.size() == 1);
 
         int i = (*permafrost_models_->first)[cells[0]];
-        permafrost_models_->second[i]->dsaturations_dpc_liq(
-          pc_liq_bf[0][bf], pc_ice_bf[0][bf], dsats);
+        permafrost_models_->second[i]->dsaturations_dpc_liq_at(
+          ncells + bf, pc_liq_bf[0][bf], pc_ice_bf[0][bf], dsats);
         satg_bf[0][bf] = dsats[0];
         satl_bf[0][bf] = dsats[1];
         sati_bf[0][bf] = dsats[2];
@@ -293,8 +295,8 @@ WRMPermafrostEvaluator::EvaluatePartialDerivative_(const State& S,
         AMANZI_ASSERT(cells.size() == 1);
 
         int i = (*permafrost_models_->first)[cells[0]];
-        permafrost_models_->second[i]->dsaturations_dpc_ice(
-          pc_liq_bf[0][bf], pc_ice_bf[0][bf], dsats);
+        permafrost_models_->second[i]->dsaturations_dpc_ice_at(
+          ncells + bf, pc_liq_bf[0][bf], pc_ice_bf[0][bf], dsats);
         satg_bf[0][bf] = dsats[0];
         satl_bf[0][bf] = dsats[1];
         sati_bf[0][bf] = dsats[2];
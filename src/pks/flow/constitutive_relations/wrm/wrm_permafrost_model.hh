@@ -34,6 +34,22 @@ class WRMPermafrostModel {
   virtual void dsaturations_dpc_liq(double pc_liq, double pc_ice, double (&dsats)[3]) = 0;
   virtual void dsaturations_dpc_ice(double pc_liq, double pc_ice, double (&dsats)[3]) = 0;
 
+  // The same, at point i of the caller's points (e.g. cells, then boundary
+  // faces).  A model may use i to reuse work done at the same point, by
+  // default it is ignored.
+  virtual void saturations_at(int i, double pc_liq, double pc_ice, double (&sats)[3])
+  {
+    saturations(pc_liq, pc_ice, sats);
+  }
+  virtual void dsaturations_dpc_liq_at(int i, double pc_liq, double pc_ice, double (&dsats)[3])
+  {
+    dsaturations_dpc_liq(pc_liq, pc_ice, dsats);
+  }
+  virtual void dsaturations_dpc_ice_at(int i, double pc_liq, double pc_ice, double (&dsats)[3])
+  {
+    dsaturations_dpc_ice(pc_liq, pc_ice, dsats);
+  }
+
  protected:
   Teuchos::ParameterList plist_;
   Teuchos::RCP<WRM> wrm_;
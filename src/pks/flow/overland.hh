@@ -67,8 +67,10 @@ class OverlandFlow : public PK_PhysicalBDF_Default {
   // updates the preconditioner
   virtual void UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h);
 
-  // -- Compute a norm on u-du and return the result.
-  virtual double ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> du);
+  // -- Compute rank-local contributions to the norm on u-du.
+  virtual void ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                              Teuchos::RCP<const TreeVector> du,
+                              ErrorNormAccumulator& enorm);
 
  protected:
   // setup methods
@@ -219,25 +219,22 @@ OverlandFlow::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
 
 
 // -----------------------------------------------------------------------------
-// Default enorm that uses an abs and rel tolerance to monitor convergence.
+// Rank-local contributions to the error norm, using an abs and rel tolerance
+// to monitor convergence.
 // -----------------------------------------------------------------------------
-double
-OverlandFlow::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> res)
+void
+OverlandFlow::ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                             Teuchos::RCP<const TreeVector> res,
+                             ErrorNormAccumulator& enorm)
 {
   const Epetra_MultiVector& pd =
     *S_next_->GetPtr<CompositeVector>(key_)->ViewComponent("cell", true);
   const Epetra_MultiVector& cv =
     *S_next_->GetPtr<CompositeVector>(cell_vol_key_)->ViewComponent("cell", true);
 
-  // VerboseObject stuff.
-  Teuchos::OSTab tab = vo_->getOSTab();
-  if (vo_->os_OK(Teuchos::VERB_MEDIUM))
-    *vo_->os() << "ENorm (Infnorm) of: " << key_ << ": " << std::endl;
-
   Teuchos::RCP<const CompositeVector> dvec = res->Data();
   double h = S_->get_time(tag_next_) - S_->get_time(tag_inter_);
 
-  double enorm_val = 0.0;
   for (CompositeVector::name_iterator comp = dvec->begin(); comp != dvec->end(); ++comp) {
     double enorm_comp = 0.0;
     int enorm_loc = -1;
@@ -268,15 +265,14 @@ OverlandFlow::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const Tre
            ->GetPtrW<CompositeVector>(
              Keys::getDerivKey(Keys::getKey(domain_, "upwind_overland_conductivity"), key_))
            ->ViewComponent("face", false);
+      const auto& face_cells = FaceCells_();
 
       for (unsigned int f = 0; f != nfaces; ++f) {
-        AmanziMesh::Entity_ID_List cells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::OWNED, &cells);
-        double cv_min =
-          cells.size() == 1 ? cv[0][cells[0]] : std::min(cv[0][cells[0]], cv[0][cells[1]]);
-        double conserved_min = cells.size() == 1 ? pd[0][cells[0]] * cv[0][cells[0]] :
-                                                   std::min(pd[0][cells[0]] * cv[0][cells[0]],
-                                                            pd[0][cells[1]] * cv[0][cells[1]]);
+        AmanziMesh::Entity_ID c0 = face_cells[2 * f];
+        AmanziMesh::Entity_ID c1 = face_cells[2 * f + 1];
+        double cv_min = c1 < 0 ? cv[0][c0] : std::min(cv[0][c0], cv[0][c1]);
+        double conserved_min = c1 < 0 ? pd[0][c0] * cv[0][c0] :
+                                        std::min(pd[0][c0] * cv[0][c0], pd[0][c1] * cv[0][c1]);
 
         double enorm_f = fluxtol_ * h * std::abs(dvec_v[0][f]) /
                          (atol_ * cv_min + rtol_ * std::abs(conserved_min));
@@ -294,29 +290,8 @@ OverlandFlow::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const Tre
       Exceptions::amanzi_throw(msg);
     }
 
-    // Write out Inf norms too.
-    if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
-      double infnorm(0.);
-      dvec_v.NormInf(&infnorm);
-
-      ENorm_t err;
-      ENorm_t l_err;
-      l_err.value = enorm_comp;
-      l_err.gid = dvec_v.Map().GID(enorm_loc);
-
-      int ierr = MPI_Allreduce(&l_err, &err, 1, MPI_DOUBLE_INT, MPI_MAXLOC, MPI_COMM_WORLD);
-      AMANZI_ASSERT(!ierr);
-      *vo_->os() << "  ENorm (" << *comp << ") = " << err.value << "[" << err.gid << "] ("
-                 << infnorm << ")" << std::endl;
-    }
-
-    enorm_val = std::max(enorm_val, enorm_comp);
+    enorm.Add(key_, *comp, enorm_comp, dvec_v.Map().GID(enorm_loc), LocalInfNorm_(dvec_v));
   }
-
-  double enorm_val_l = enorm_val;
-  int ierr = MPI_Allreduce(&enorm_val_l, &enorm_val, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-  AMANZI_ASSERT(!ierr);
-  return enorm_val;
 };
 
 
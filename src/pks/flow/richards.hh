@@ -70,6 +70,13 @@ Solves Richards equation:
      options, as all others probably should match those in
      `"diffusion`", and default to those values.
 
+   * `"inverse`" ``[inverse-typed-spec]`` **optional** The inverse of the
+     preconditioner.  If the `"iterative method`" is `"pipelined pcg`" or
+     `"pipelined gmres`", see `iterative-method-pipelined-spec`_, the Krylov
+     method is applied to the preconditioner operator with a single global
+     reduction per iteration, using the `"preconditioning method`" as its
+     preconditioner.
+
    * `"surface rel perm strategy`" ``[string]`` **none** Approach for
      specifying the relative permeabiilty on the surface face.
      `"clobber`" is frequently used for cases where a surface rel
@@ -231,6 +238,7 @@ Solves Richards equation:
 #include "EvaluatorPrimary.hh"
 #include "PDE_DiffusionFactory.hh"
 #include "PDE_Accumulation.hh"
+#include "pipelined_krylov.hh"
 #include "PK_Factory.hh"
 #include "pk_physical_bdf_default.hh"
 
@@ -386,6 +394,8 @@ class Richards : public PK_PhysicalBDF_Default {
   Teuchos::RCP<Operators::PDE_DiffusionWithGravity> preconditioner_diff_;
   Teuchos::RCP<Operators::PDE_DiffusionWithGravity> face_matrix_diff_;
   Teuchos::RCP<Operators::PDE_Accumulation> preconditioner_acc_;
+  Teuchos::RCP<Operators::PipelinedKrylov<Operators::Operator, CompositeVector>>
+    pipelined_inverse_;
 
   // flag to do jacobian and therefore coef derivs
   bool precon_used_;
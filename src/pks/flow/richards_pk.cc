@@ -275,9 +275,22 @@ Richards::SetupRichardsFlow_()
     mfd_pc_plist.sublist("inverse").setParameters(plist_->sublist("linear solver"));
   }
 
+  //    a pipelined Krylov method wraps the operator, whose own inverse is then
+  //    only the preconditioner
+  Teuchos::ParameterList pipelined_inv_list;
+  if (precon_used_ && Operators::isPipelinedKrylov(mfd_pc_plist.sublist("inverse"))) {
+    pipelined_inv_list = mfd_pc_plist.sublist("inverse");
+    mfd_pc_plist.set("inverse", Operators::preconditionerOnly(pipelined_inv_list));
+  }
+
   //    create the operator
   preconditioner_diff_ = opfactory.CreateWithGravity(mfd_pc_plist, mesh_, bc_);
   preconditioner_ = preconditioner_diff_->global_operator();
+  if (pipelined_inv_list.numParams() > 0) {
+    pipelined_inverse_ = Teuchos::rcp(
+      new Operators::PipelinedKrylov<Operators::Operator, CompositeVector>(pipelined_inv_list,
+                                                                           preconditioner_));
+  }
 
   //    If using approximate Jacobian for the preconditioner, we also need
   //    derivative information.  For now this means upwinding the derivative.
@@ -117,7 +117,17 @@ Richards::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<Tre
 
   // Apply the preconditioner
   db_->WriteVector("p_res", u->Data().ptr(), true);
-  int ierr = preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
+  int ierr;
+  if (pipelined_inverse_ != Teuchos::null) {
+    Pu->PutScalar(0.);
+    ierr = pipelined_inverse_->ApplyInverse(*u->Data(), *Pu->Data());
+    if (vo_->os_OK(Teuchos::VERB_HIGH))
+      *vo_->os() << "  pipelined Krylov: " << pipelined_inverse_->returned_code_string() << " in "
+                 << pipelined_inverse_->num_itrs() << " itrs, residual "
+                 << pipelined_inverse_->residual() << std::endl;
+  } else {
+    ierr = preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
+  }
   db_->WriteVector("PC*p_res", Pu->Data().ptr(), true);
 
   return (ierr > 0) ? 0 : 1;
@@ -198,11 +198,13 @@ SnowDistribution::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector>
   preconditioner_diff_->ApplyBCs(true, true, true);
 };
 
-double
-SnowDistribution::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> du)
+// Rank-local contribution to the error norm, based upon the error in mass
+// conservation.
+void
+SnowDistribution::ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                                 Teuchos::RCP<const TreeVector> du,
+                                 ErrorNormAccumulator& enorm)
 {
-  Teuchos::OSTab tab = vo_->getOSTab();
-
   Teuchos::RCP<const CompositeVector> res = du->Data();
   const Epetra_MultiVector& res_c = *res->ViewComponent("cell", false);
   const Epetra_MultiVector& precip_c = *u->Data()->ViewComponent("cell", false);
@@ -211,10 +213,8 @@ SnowDistribution::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const
     *S_next_->GetPtrW<CompositeVector>(Keys::getKey(domain_, "cell_volume"))
        ->ViewComponent("cell", false);
   double dt = S_->get_time(tag_next_) - S_->get_time(tag_inter_);
-  std::vector<double> time(1, S_->get_time(tag_next_));
 
   // Cell error is based upon error in mass conservation
-  double Qe = (*precip_func_)(time);
   double enorm_cell(0.);
   int bad_cell = -1;
   unsigned int ncells = res_c.MyLength();
@@ -227,25 +227,7 @@ SnowDistribution::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const
     }
   }
 
-  // Write out Inf norms too.
-  if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
-    double infnorm_c(0.);
-    res_c.NormInf(&infnorm_c);
-
-    ENorm_t err_c;
-    ENorm_t l_err_c;
-    l_err_c.value = enorm_cell;
-    l_err_c.gid = res_c.Map().GID(bad_cell);
-
-    MPI_Allreduce(&l_err_c, &err_c, 1, MPI_DOUBLE_INT, MPI_MAXLOC, MPI_COMM_WORLD);
-
-    *vo_->os() << "ENorm (cells) = " << err_c.value << "[" << err_c.gid << "] (" << infnorm_c << ")"
-               << std::endl;
-  }
-
-  double buf = enorm_cell;
-  MPI_Allreduce(&buf, &enorm_cell, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-  return enorm_cell;
+  enorm.Add(key_, "cell", enorm_cell, res_c.Map().GID(bad_cell), LocalInfNorm_(res_c));
 };
 
 bool
@@ -0,0 +1,76 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Pre-resolved handles for moving one variable between a domain set and a global vector.
+#include "errors.hh"
+#include "domain_set_exchange.hh"
+
+namespace Amanzi {
+
+void
+DomainSetExchange::resolve(State& S,
+                           const std::vector<Key>& keys,
+                           const std::vector<Tag>& tags,
+                           bool primary,
+                           const Key& owner)
+{
+  AMANZI_ASSERT(keys.size() == tags.size());
+  vecs_.resize(keys.size());
+  vals_.resize(keys.size());
+  evals_.resize(keys.size());
+
+  for (int i = 0; i != keys.size(); ++i) {
+    Key l_owner = owner.empty() ? S.GetRecord(keys[i], tags[i]).owner() : owner;
+    vecs_[i] = &S.GetW<CompositeVector>(keys[i], tags[i], l_owner);
+
+    vals_[i] = &(*vecs_[i]->ViewComponent("cell", false))[0][0];
+
+    evals_[i] = nullptr;
+    if (primary) {
+      if (S.HasEvaluator(keys[i], tags[i])) {
+        evals_[i] = dynamic_cast<EvaluatorPrimaryCV*>(&S.GetEvaluator(keys[i], tags[i]));
+      }
+      if (evals_[i] == nullptr) {
+        Errors::Message msg;
+        msg << "Expected primary variable evaluator for " << keys[i] << " @ " << tags[i].get();
+        Exceptions::amanzi_throw(msg);
+      }
+    }
+  }
+}
+
+
+void
+DomainSetExchange::changedAll()
+{
+  for (auto eval : evals_) {
+    if (eval) eval->SetChanged();
+  }
+}
+
+
+void
+DomainSetExchange::scatter(const Epetra_MultiVector& star)
+{
+  AMANZI_ASSERT(star.MyLength() == size());
+  const double* star_v = star[0];
+  for (int i = 0; i != vals_.size(); ++i) *vals_[i] = star_v[i];
+  changedAll();
+}
+
+
+void
+DomainSetExchange::gather(Epetra_MultiVector& star) const
+{
+  AMANZI_ASSERT(star.MyLength() == size());
+  double* star_v = star[0];
+  for (int i = 0; i != vals_.size(); ++i) star_v[i] = *vals_[i];
+}
+
+} // namespace Amanzi
@@ -0,0 +1,77 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Pre-resolved handles for moving one variable between a domain set and a global vector.
+/*!
+
+Split-flux MPCs move data between a global "star" vector, with one cell per
+subdomain, and a variable on each subdomain of a domain set, e.g. the surface
+of each column.  Looking up each subdomain's record by Key and Tag on every
+coupling step costs far more than the copy itself when there are many
+subdomains per rank.  This resolves, once, each subdomain's vector, the
+pointer to its first cell value (the only one for a surface cell of a column),
+and, for variables that are marked as changed, its primary variable evaluator,
+so that scatter and gather are flat loops.
+
+Data must exist, so this is resolved after State::Setup(), e.g. in
+Initialize().
+
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Epetra_MultiVector.h"
+#include "CompositeVector.hh"
+#include "EvaluatorPrimary.hh"
+#include "State.hh"
+
+namespace Amanzi {
+
+class DomainSetExchange {
+ public:
+  DomainSetExchange() = default;
+
+  // Resolve keys[i] at tags[i], writable by owner, or by the record's owner if
+  // owner is empty.  If primary, each must have a primary variable evaluator,
+  // which changed() marks as changed; otherwise, changed() is a no-op.
+  void resolve(State& S,
+               const std::vector<Key>& keys,
+               const std::vector<Tag>& tags,
+               bool primary,
+               const Key& owner = "");
+
+  bool resolved() const { return !vecs_.empty(); }
+  int size() const { return vecs_.size(); }
+
+  // the i-th subdomain's vector, and its first cell value
+  CompositeVector& vector(int i) { return *vecs_[i]; }
+  double& operator[](int i) { return *vals_[i]; }
+
+  // mark the i-th, or all, primary variable evaluators as changed
+  void changed(int i)
+  {
+    if (evals_[i]) evals_[i]->SetChanged();
+  }
+  void changedAll();
+
+  // star[0][i] --> i-th subdomain's first cell value, marking all as changed
+  void scatter(const Epetra_MultiVector& star);
+
+  // i-th subdomain's first cell value --> star[0][i]
+  void gather(Epetra_MultiVector& star) const;
+
+ private:
+  std::vector<CompositeVector*> vecs_;
+  std::vector<double*> vals_;
+  std::vector<EvaluatorPrimaryCV*> evals_;
+};
+
+} // namespace Amanzi
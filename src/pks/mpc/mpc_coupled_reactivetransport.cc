@@ -45,6 +45,17 @@ MPCCoupledReactiveTransport::MPCCoupledReactiveTransport(
   mol_dens_key_ = Keys::readKey(*plist_, domain_, "molar density liquid", "molar_density_liquid");
   mol_dens_surf_key_ =
     Keys::readKey(*plist_, domain_surf_, "surface molar density liquid", "molar_density_liquid");
+
+  double skip_rtol = plist_->get<double>("chemistry skip relative tolerance", -1.);
+  if (skip_rtol > 0.) {
+    temp_key_ = Keys::readKey(*plist_, domain_, "temperature", "temperature");
+    temp_surf_key_ = Keys::readKey(*plist_, domain_surf_, "surface temperature", "temperature");
+    wc_key_ = Keys::readKey(*plist_, domain_, "water content", "water_content");
+    wc_surf_key_ = Keys::readKey(*plist_, domain_surf_, "surface water content", "water_content");
+    double max_interval = plist_->get<double>("chemistry skip maximum interval [s]", 86400.);
+    chem_change_ = Teuchos::rcp(new ChemistryChangeDetector(skip_rtol, max_interval));
+    chem_change_surf_ = Teuchos::rcp(new ChemistryChangeDetector(skip_rtol, max_interval));
+  }
 }
 
 
@@ -81,6 +92,21 @@ MPCCoupledReactiveTransport::Setup()
     ->SetGhosted()
     ->AddComponent("cell", AmanziMesh::Entity_kind::CELL, 1);
   S_->RequireEvaluator(mol_dens_surf_key_, tag_next_);
+
+  if (chem_change_ != Teuchos::null) {
+    for (const auto& key : { temp_key_, wc_key_ }) {
+      S_->Require<CompositeVector, CompositeVectorSpace>(key, tag_next_)
+        .SetMesh(S_->GetMesh(domain_))
+        ->AddComponent("cell", AmanziMesh::Entity_kind::CELL, 1);
+      S_->RequireEvaluator(key, tag_next_);
+    }
+    for (const auto& key : { temp_surf_key_, wc_surf_key_ }) {
+      S_->Require<CompositeVector, CompositeVectorSpace>(key, tag_next_)
+        .SetMesh(S_->GetMesh(domain_surf_))
+        ->AddComponent("cell", AmanziMesh::Entity_kind::CELL, 1);
+      S_->RequireEvaluator(key, tag_next_);
+    }
+  }
 }
 
 
@@ -194,31 +220,72 @@ MPCCoupledReactiveTransport::AdvanceStep(double t_old, double t_new, bool reinit
     return fail;
   }
 
-  // Chemistry on the surface
+  // Gather inputs for both chemistry PKs.
   Teuchos::RCP<Epetra_MultiVector> tcc_surf =
     S_->GetW<CompositeVector>(tcc_surf_key_, tag_next_, "state").ViewComponent("cell", true);
   S_->GetEvaluator(mol_dens_surf_key_, tag_next_).Update(*S_, name_);
   Teuchos::RCP<const Epetra_MultiVector> mol_dens_surf =
     S_->Get<CompositeVector>(mol_dens_surf_key_, tag_next_).ViewComponent("cell", true);
-  fail = advanceChemistry(
-    chemistry_pk_surf_, t_old, t_new, reinit, *mol_dens_surf, tcc_surf, *alquimia_surf_timer_);
+
+  Teuchos::RCP<Epetra_MultiVector> tcc =
+    S_->GetW<CompositeVector>(tcc_key_, tag_next_, "state").ViewComponent("cell", true);
+  S_->GetEvaluator(mol_dens_key_, tag_next_).Update(*S_, name_);
+  Teuchos::RCP<const Epetra_MultiVector> mol_dens =
+    S_->Get<CompositeVector>(mol_dens_key_, tag_next_).ViewComponent("cell", true);
+
+  // Skip the solve in a domain whose inputs have not changed since its last
+  // solve, keeping its current concentrations.
+  // Otherwise, integrate over any skipped steps as well.
+  bool skip_surf = false, skip = false;
+  double t_chem_old_surf = t_old, t_chem_old = t_old;
+  if (chem_change_ != Teuchos::null && !reinit) {
+    skip_surf =
+      isChemistryQuiescent_(*chem_change_surf_, temp_surf_key_, wc_surf_key_, *tcc_surf, t_new);
+    skip = isChemistryQuiescent_(*chem_change_, temp_key_, wc_key_, *tcc, t_new);
+    t_chem_old_surf = chem_change_surf_->SolveStartTime(t_old);
+    t_chem_old = chem_change_->SolveStartTime(t_old);
+  }
+
+  bool fail_surf = false;
+  if (!skip_surf) {
+    fail_surf = advanceChemistry(chemistry_pk_surf_,
+                                 t_chem_old_surf,
+                                 t_new,
+                                 reinit,
+                                 *mol_dens_surf,
+                                 tcc_surf,
+                                 *alquimia_surf_timer_);
+  }
+  if (!fail_surf && !skip) {
+    fail =
+      advanceChemistry(chemistry_pk_, t_chem_old, t_new, reinit, *mol_dens, tcc, *alquimia_timer_);
+  }
+
+  if (chem_change_ != Teuchos::null) {
+    if (fail_surf || fail) {
+      // the retry solves from t_old, even if this was a catch-up solve
+      chem_change_surf_->FailStep(t_old);
+      chem_change_->FailStep(t_old);
+    } else {
+      if (!skip_surf) {
+        recordChemistry_(*chem_change_surf_, temp_surf_key_, wc_surf_key_, *tcc_surf, t_new);
+      }
+      if (!skip) recordChemistry_(*chem_change_, temp_key_, wc_key_, *tcc, t_new);
+    }
+  }
+
+  // Chemistry on the surface
   changedEvaluatorPrimary(tcc_surf_key_, tag_next_, *S_);
-  if (fail) {
+  if (fail_surf) {
     if (vo_->os_OK(Teuchos::VERB_MEDIUM))
       *vo_->os() << chemistry_pk_surf_->name() << " failed." << std::endl;
-    return fail;
+    return fail_surf;
   } else {
     transport_pk_surf_->debugger()->WriteCellVector("tcc (chem)", *tcc_surf);
     transport_pk_surf_->VV_PrintSoluteExtrema(*tcc_surf, t_new - t_old);
   }
 
   // Chemistry in the subsurface
-  Teuchos::RCP<Epetra_MultiVector> tcc =
-    S_->GetW<CompositeVector>(tcc_key_, tag_next_, "state").ViewComponent("cell", true);
-  S_->GetEvaluator(mol_dens_key_, tag_next_).Update(*S_, name_);
-  Teuchos::RCP<const Epetra_MultiVector> mol_dens =
-    S_->Get<CompositeVector>(mol_dens_key_, tag_next_).ViewComponent("cell", true);
-  fail = advanceChemistry(chemistry_pk_, t_old, t_new, reinit, *mol_dens, tcc, *alquimia_timer_);
   changedEvaluatorPrimary(tcc_key_, tag_next_, *S_);
   if (fail) {
     if (vo_->os_OK(Teuchos::VERB_MEDIUM))
@@ -234,4 +301,58 @@ MPCCoupledReactiveTransport::AdvanceStep(double t_old, double t_new, bool reinit
 };
 
 
+// -----------------------------------------------------------------------------
+// Fail the sub-PKs, and restart any chemistry catch-up at t_old.
+// -----------------------------------------------------------------------------
+void
+MPCCoupledReactiveTransport::FailStep(double t_old, double t_new, const Tag& tag)
+{
+  WeakMPC::FailStep(t_old, t_new, tag);
+  if (chem_change_ != Teuchos::null) {
+    chem_change_surf_->FailStep(t_old);
+    chem_change_->FailStep(t_old);
+  }
+}
+
+
+bool
+MPCCoupledReactiveTransport::isChemistryQuiescent_(ChemistryChangeDetector& detector,
+                                                   const Key& temp_key,
+                                                   const Key& wc_key,
+                                                   const Epetra_MultiVector& tcc,
+                                                   double t)
+{
+  S_->GetEvaluator(temp_key, tag_next_).Update(*S_, name_);
+  S_->GetEvaluator(wc_key, tag_next_).Update(*S_, name_);
+  bool quiescent =
+    detector.IsQuiescent(tcc,
+                         *S_->Get<CompositeVector>(temp_key, tag_next_).ViewComponent("cell", false),
+                         *S_->Get<CompositeVector>(wc_key, tag_next_).ViewComponent("cell", false),
+                         t);
+
+  if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+    *vo_->os() << "Chemistry in \"" << Keys::getDomain(temp_key) << "\": "
+               << detector.num_quiescent_cells() << " of " << detector.num_cells()
+               << " cells unchanged, " << (quiescent ? "skipping" : "solving") << " (skipped "
+               << detector.num_skipped() << ", solved " << detector.num_solved() << ")"
+               << std::endl;
+  }
+  return quiescent;
+}
+
+
+void
+MPCCoupledReactiveTransport::recordChemistry_(ChemistryChangeDetector& detector,
+                                              const Key& temp_key,
+                                              const Key& wc_key,
+                                              const Epetra_MultiVector& tcc,
+                                              double t)
+{
+  detector.Record(tcc,
+                  *S_->Get<CompositeVector>(temp_key, tag_next_).ViewComponent("cell", false),
+                  *S_->Get<CompositeVector>(wc_key, tag_next_).ViewComponent("cell", false),
+                  t);
+}
+
+
 } // namespace Amanzi
@@ -11,6 +11,18 @@
   This is the mpc_pk component of the Amanzi code.
 
   Process kernel for coupling of Transport_PK and Chemistry_PK.
+
+  If "chemistry skip relative tolerance" is positive (default -1, off), the
+  chemistry solve in a domain is skipped when, in every cell, total component
+  concentration, temperature and water content are all within this relative
+  tolerance of their values at that domain's last solve.  The keys used are
+  "temperature" and "water content", and "surface temperature" and "surface
+  water content".  A solve is forced once "chemistry skip maximum interval
+  [s]" (default 86400) has passed since that domain's last solve, and each
+  solve integrates the chemistry from the end of the last solve, so kinetic
+  reactions are delayed by at most that interval rather than dropped.  If a
+  step fails, its retry integrates only from the start of that step, so that
+  a cut step also cuts the chemistry interval; the skipped time is dropped.
 */
 
 
@@ -24,6 +36,7 @@
 #include "transport_ats.hh"
 #include "Chemistry_PK.hh"
 #include "weak_mpc.hh"
+#include "pk_helpers.hh"
 
 namespace Amanzi {
 
@@ -39,19 +52,35 @@ class MPCCoupledReactiveTransport : public WeakMPC {
   virtual void Setup() override;
   virtual void Initialize() override;
   virtual bool AdvanceStep(double t_old, double t_new, bool reinit = false) override;
+  virtual void FailStep(double t_old, double t_new, const Tag& tag) override;
 
  protected:
   virtual void cast_sub_pks_();
 
+  bool isChemistryQuiescent_(ChemistryChangeDetector& detector,
+                             const Key& temp_key,
+                             const Key& wc_key,
+                             const Epetra_MultiVector& tcc,
+                             double t);
+  void recordChemistry_(ChemistryChangeDetector& detector,
+                        const Key& temp_key,
+                        const Key& wc_key,
+                        const Epetra_MultiVector& tcc,
+                        double t);
+
  protected:
   bool chem_step_succeeded_;
 
   Key domain_, domain_surf_;
   Key tcc_key_, tcc_surf_key_;
   Key mol_dens_key_, mol_dens_surf_key_;
+  Key temp_key_, temp_surf_key_;
+  Key wc_key_, wc_surf_key_;
 
   Teuchos::RCP<Teuchos::Time> alquimia_timer_, alquimia_surf_timer_;
 
+  Teuchos::RCP<ChemistryChangeDetector> chem_change_, chem_change_surf_;
+
   // storage for the component concentration intermediate values
   Teuchos::RCP<MPCCoupledTransport> coupled_transport_pk_;
   Teuchos::RCP<WeakMPC> coupled_chemistry_pk_;
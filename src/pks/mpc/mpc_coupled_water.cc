@@ -345,8 +345,10 @@ MPCCoupledWater::ModifyCorrection(double h,
 }
 
 
-double
-MPCCoupledWater::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> res)
+void
+MPCCoupledWater::ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                                Teuchos::RCP<const TreeVector> res,
+                                ErrorNormAccumulator& enorm)
 {
   // move the surface face residual onto the surface cell.
   auto res2 = Teuchos::rcp(new TreeVector(*res, INIT_MODE_COPY));
@@ -361,7 +363,7 @@ MPCCoupledWater::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const
       res_face[0][f] = 0.;
     }
   }
-  return StrongMPC<PK_PhysicalBDF_Default>::ErrorNorm(u, res2);
+  StrongMPC<PK_PhysicalBDF_Default>::ErrorNormLocal(u, res2, enorm);
 }
 
 
@@ -81,8 +81,9 @@ class MPCCoupledWater : public StrongMPC<PK_PhysicalBDF_Default> {
                    Teuchos::RCP<const TreeVector> u,
                    Teuchos::RCP<TreeVector> du) override;
 
-  virtual double
-  ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> res) override;
+  virtual void ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                              Teuchos::RCP<const TreeVector> res,
+                              ErrorNormAccumulator& enorm) override;
 
   Teuchos::RCP<Operators::Operator> preconditioner() { return precon_; }
 
@@ -114,6 +114,7 @@ void
 MPCCoupledWaterSplitFlux::Initialize()
 {
   sub_pks_[1]->Initialize();
+  if (is_domain_set_) ResolveDomainSet_();
   CopyPrimaryToStar_();
   sub_pks_[0]->Initialize();
 
@@ -246,30 +247,47 @@ MPCCoupledWaterSplitFlux::CopyPrimaryToStar_Standard_()
 }
 
 // -----------------------------------------------------------------------------
-// Copy the primary variable to the star system assuming a DomainSet domain
+// Resolve, once, the per-subdomain records touched when coupling to a DomainSet
 // -----------------------------------------------------------------------------
 void
-MPCCoupledWaterSplitFlux::CopyPrimaryToStar_DomainSet_()
+MPCCoupledWaterSplitFlux::ResolveDomainSet_()
 {
   const auto& domain_set = *S_->GetDomainSet(domain_set_);
+  std::vector<Key> p_keys, p_sub_keys, q_keys;
+  std::vector<Tag> tags_next, tags_current;
+  for (const auto& subdomain : domain_set) {
+    p_keys.emplace_back(Keys::getKey(subdomain, p_primary_variable_suffix_));
+    p_sub_keys.emplace_back(Keys::getKey(
+      domain_sub_, Keys::getDomainSetIndex(subdomain), p_sub_primary_variable_suffix_));
+    if (coupling_ != "pressure")
+      q_keys.emplace_back(Keys::getKey(subdomain, p_lateral_flow_source_suffix_));
+    tags_next.emplace_back(get_ds_tag_next_(subdomain));
+    tags_current.emplace_back(get_ds_tag_current_(subdomain));
+  }
+
+  ds_p_next_.resolve(*S_, p_keys, tags_next, false);
+  if (coupling_ != "flux") {
+    ds_p_current_.resolve(*S_, p_keys, tags_current, true);
+    ds_p_sub_current_.resolve(*S_, p_sub_keys, tags_current, false);
+  }
+  if (coupling_ != "pressure") ds_q_next_.resolve(*S_, q_keys, tags_next, true);
+}
 
+
+// -----------------------------------------------------------------------------
+// Copy the primary variable to the star system assuming a DomainSet domain
+// -----------------------------------------------------------------------------
+void
+MPCCoupledWaterSplitFlux::CopyPrimaryToStar_DomainSet_()
+{
   // copy p primary variables into star primary variable
   auto p_owner = S_->GetRecord(p_primary_variable_star_, tags_[0].second).owner();
   auto& p_star = *S_->GetW<CompositeVector>(p_primary_variable_star_, tags_[0].second, p_owner)
                     .ViewComponent("cell", false);
 
-  auto ds_iter = domain_set.begin();
+  ds_p_next_.gather(p_star);
   for (int c = 0; c != p_star.MyLength(); ++c) {
-    Key p_key = Keys::getKey(*ds_iter, p_primary_variable_suffix_);
-    Tag ds_tag_next = get_ds_tag_next_(*ds_iter);
-    const auto& p = *S_->Get<CompositeVector>(p_key, ds_tag_next).ViewComponent("cell", false);
-    AMANZI_ASSERT(p.MyLength() == 1);
-    if (p[0][0] <= 101325.0) {
-      p_star[0][c] = 101325.;
-    } else {
-      p_star[0][c] = p[0][0];
-    }
-    ++ds_iter;
+    if (p_star[0][c] <= 101325.0) p_star[0][c] = 101325.;
   }
   changedEvaluatorPrimary(p_primary_variable_star_, tags_[0].second, *S_);
 }
@@ -425,34 +443,18 @@ MPCCoupledWaterSplitFlux::CopyStarToPrimary_Standard_Hybrid_()
 void
 MPCCoupledWaterSplitFlux::CopyStarToPrimary_DomainSet_Pressure_()
 {
-  const auto& domain_set = *S_->GetDomainSet(domain_set_);
-
   // copy p primary variables into star primary variable
   const auto& p_star = *S_->GetPtr<CompositeVector>(p_primary_variable_star_, tags_[0].second)
                           ->ViewComponent("cell", false);
 
-  auto ds_iter = domain_set.begin();
   for (int c = 0; c != p_star.MyLength(); ++c) {
-    Tag ds_tag_next = get_ds_tag_next_(*ds_iter);
-    Tag ds_tag_current = get_ds_tag_current_(*ds_iter);
-
     if (p_star[0][c] > 101325.0000001) {
-      Key p_key = Keys::getKey(*ds_iter, p_primary_variable_suffix_);
-      auto p_owner = S_->GetRecord(p_key, ds_tag_current).owner();
-      auto& p =
-        *S_->GetW<CompositeVector>(p_key, ds_tag_current, p_owner).ViewComponent("cell", false);
-      AMANZI_ASSERT(p.MyLength() == 1);
-      p[0][0] = p_star[0][c];
+      ds_p_current_[c] = p_star[0][c];
 
       // ?? what about WC?
-      changedEvaluatorPrimary(p_key, ds_tag_current, *S_);
-      Key p_sub_key = Keys::getKey(
-        domain_sub_, Keys::getDomainSetIndex(*ds_iter), p_sub_primary_variable_suffix_);
-      auto p_sub_owner = S_->GetRecord(p_sub_key, ds_tag_current).owner();
-      CopySurfaceToSubsurface(S_->Get<CompositeVector>(p_key, ds_tag_current),
-                              S_->GetW<CompositeVector>(p_sub_key, ds_tag_current, p_sub_owner));
+      ds_p_current_.changed(c);
+      CopySurfaceToSubsurface(ds_p_current_.vector(c), ds_p_sub_current_.vector(c));
     }
-    ++ds_iter;
   }
 }
 
@@ -464,7 +466,6 @@ void
 MPCCoupledWaterSplitFlux::CopyStarToPrimary_DomainSet_Flux_()
 {
   double dt = S_->get_time(tags_[0].second) - S_->get_time(tags_[0].first);
-  const auto& domain_set = *S_->GetDomainSet(domain_set_);
 
   // grab the data, difference
   Epetra_MultiVector q_div(*S_->Get<CompositeVector>(p_conserved_variable_star_, tags_[0].second)
@@ -484,16 +485,7 @@ MPCCoupledWaterSplitFlux::CopyStarToPrimary_DomainSet_Flux_()
     0.);
 
   // copy into columns
-  auto ds_iter = domain_set.begin();
-  for (int c = 0; c != q_div.MyLength(); ++c) {
-    Tag ds_tag_next = get_ds_tag_next_(*ds_iter);
-    Key p_key = Keys::getKey(*ds_iter, p_lateral_flow_source_suffix_);
-    auto p_owner = S_->GetRecord(p_key, ds_tag_next).owner();
-    (*S_->GetW<CompositeVector>(p_key, ds_tag_next, p_owner).ViewComponent("cell", false))[0][0] =
-      q_div[0][c];
-    changedEvaluatorPrimary(p_key, ds_tag_next, *S_);
-    ++ds_iter;
-  }
+  ds_q_next_.scatter(q_div);
 }
 
 
@@ -504,7 +496,6 @@ void
 MPCCoupledWaterSplitFlux::CopyStarToPrimary_DomainSet_Hybrid_()
 {
   double dt = S_->get_time(tags_[0].second) - S_->get_time(tags_[0].first);
-  const auto& domain_set = *S_->GetDomainSet(domain_set_);
 
   // grab the data, difference
   Epetra_MultiVector q_div(*S_->Get<CompositeVector>(p_conserved_variable_star_, tags_[0].second)
@@ -528,43 +519,23 @@ MPCCoupledWaterSplitFlux::CopyStarToPrimary_DomainSet_Hybrid_()
                           ->ViewComponent("cell", false);
 
   // in the case of water loss, use pressure.  in the case of water gain, use flux.
-  auto ds_iter = domain_set.begin();
   for (int c = 0; c != p_star.MyLength(); ++c) {
-    Tag ds_tag_next = get_ds_tag_next_(*ds_iter);
-    Tag ds_tag_current = get_ds_tag_current_(*ds_iter);
     if (p_star[0][c] > 101325. && q_div[0][c] < 0.) {
       // use the Dirichlet
-      Key p_key = Keys::getKey(*ds_iter, p_primary_variable_suffix_);
-      auto p_owner = S_->GetRecord(p_key, ds_tag_current).owner();
-      auto& p =
-        *S_->GetW<CompositeVector>(p_key, ds_tag_current, p_owner).ViewComponent("cell", false);
-      AMANZI_ASSERT(p.MyLength() == 1);
-      p[0][0] = p_star[0][c];
+      ds_p_current_[c] = p_star[0][c];
 
       // ?? what about WC?
-      changedEvaluatorPrimary(p_key, ds_tag_current, *S_);
-      Key p_sub_key = Keys::getKey(
-        domain_sub_, Keys::getDomainSetIndex(*ds_iter), p_sub_primary_variable_suffix_);
-      auto p_sub_owner = S_->GetRecord(p_sub_key, ds_tag_current).owner();
-      CopySurfaceToSubsurface(S_->Get<CompositeVector>(p_key, ds_tag_current),
-                              S_->GetW<CompositeVector>(p_sub_key, ds_tag_current, p_sub_owner));
+      ds_p_current_.changed(c);
+      CopySurfaceToSubsurface(ds_p_current_.vector(c), ds_p_sub_current_.vector(c));
 
       // set the lateral flux to 0
-      Key p_lf_key = Keys::getKey(*ds_iter, p_lateral_flow_source_suffix_);
-      (*S_->GetW<CompositeVector>(p_lf_key, ds_tag_next, p_lf_key)
-          .ViewComponent("cell", false))[0][0] = 0.;
-      changedEvaluatorPrimary(p_lf_key, ds_tag_next, *S_);
-
+      ds_q_next_[c] = 0.;
     } else {
       // use flux
-      Key p_key = Keys::getKey(*ds_iter, p_lateral_flow_source_suffix_);
-      auto p_owner = S_->GetRecord(p_key, ds_tag_next).owner();
-      (*S_->GetW<CompositeVector>(p_key, ds_tag_next, p_owner).ViewComponent("cell", false))[0][0] =
-        q_div[0][c];
-      changedEvaluatorPrimary(p_key, ds_tag_next, *S_);
+      ds_q_next_[c] = q_div[0][c];
     }
-    ++ds_iter;
   }
+  ds_q_next_.changedAll();
 }
 
 
@@ -52,6 +52,7 @@ Note that this can be used with either a 3D subsurface solve, by setting the
 
 #include "PK.hh"
 #include "mpc_subcycled.hh"
+#include "domain_set_exchange.hh"
 
 namespace Amanzi {
 
@@ -75,6 +76,7 @@ class MPCCoupledWaterSplitFlux : public MPCSubcycled {
   void CopyPrimaryToStar_();
   void CopyStarToPrimary_();
 
+  void ResolveDomainSet_();
   void CopyPrimaryToStar_DomainSet_();
   void CopyStarToPrimary_DomainSet_Pressure_();
   void CopyStarToPrimary_DomainSet_Flux_();
@@ -125,6 +127,12 @@ class MPCCoupledWaterSplitFlux : public MPCSubcycled {
 
   bool is_domain_set_;
 
+  // per-subdomain records, resolved once in Initialize()
+  DomainSetExchange ds_p_next_;
+  DomainSetExchange ds_p_current_;
+  DomainSetExchange ds_p_sub_current_;
+  DomainSetExchange ds_q_next_;
+
  private:
   // factory registration
   static RegisteredPKFactory<MPCCoupledWaterSplitFlux> reg_;
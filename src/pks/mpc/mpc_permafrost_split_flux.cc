@@ -145,6 +145,7 @@ void
 MPCPermafrostSplitFlux::Initialize()
 {
   sub_pks_[1]->Initialize();
+  if (is_domain_set_) ResolveDomainSet_();
   CopyPrimaryToStar_();
   sub_pks_[0]->Initialize();
 
@@ -297,13 +298,53 @@ MPCPermafrostSplitFlux::CopyPrimaryToStar_Standard_()
 }
 
 // -----------------------------------------------------------------------------
-// Copy the primary variable to the star system assuming a DomainSet domain
+// Resolve, once, the per-subdomain records touched when coupling to a DomainSet
 // -----------------------------------------------------------------------------
 void
-MPCPermafrostSplitFlux::CopyPrimaryToStar_DomainSet_()
+MPCPermafrostSplitFlux::ResolveDomainSet_()
 {
   const auto& domain_set = *S_->GetDomainSet(domain_set_);
+  std::vector<Key> p_keys, WC_keys, T_keys, E_keys, p_sub_keys, T_sub_keys, q_keys, qE_keys;
+  std::vector<Tag> tags_next, tags_current;
+  for (const auto& subdomain : domain_set) {
+    auto index = Keys::getDomainSetIndex(subdomain);
+    p_keys.emplace_back(Keys::getKey(subdomain, p_primary_variable_suffix_));
+    WC_keys.emplace_back(Keys::getKey(subdomain, p_conserved_variable_suffix_));
+    T_keys.emplace_back(Keys::getKey(subdomain, T_primary_variable_suffix_));
+    E_keys.emplace_back(Keys::getKey(subdomain, T_conserved_variable_suffix_));
+    p_sub_keys.emplace_back(Keys::getKey(domain_sub_, index, p_sub_primary_variable_suffix_));
+    T_sub_keys.emplace_back(Keys::getKey(domain_sub_, index, T_sub_primary_variable_suffix_));
+    if (coupling_ != "pressure") {
+      q_keys.emplace_back(Keys::getKey(subdomain, p_lateral_flow_source_suffix_));
+      qE_keys.emplace_back(Keys::getKey(subdomain, T_lateral_flow_source_suffix_));
+    }
+    tags_next.emplace_back(get_ds_tag_next_(subdomain));
+    tags_current.emplace_back(get_ds_tag_current_(subdomain));
+  }
+
+  ds_p_next_.resolve(*S_, p_keys, tags_next, false);
+  ds_T_next_.resolve(*S_, T_keys, tags_next, false);
+  if (coupling_ != "flux") {
+    ds_p_current_.resolve(*S_, p_keys, tags_current, true);
+    ds_WC_current_.resolve(*S_, WC_keys, tags_current, false);
+    ds_T_current_.resolve(*S_, T_keys, tags_current, true);
+    ds_E_current_.resolve(*S_, E_keys, tags_current, false);
+    ds_p_sub_current_.resolve(*S_, p_sub_keys, tags_current, false);
+    ds_T_sub_current_.resolve(*S_, T_sub_keys, tags_current, false);
+  }
+  if (coupling_ != "pressure") {
+    ds_q_next_.resolve(*S_, q_keys, tags_next, true, name_);
+    ds_qE_next_.resolve(*S_, qE_keys, tags_next, true, name_);
+  }
+}
 
+
+// -----------------------------------------------------------------------------
+// Copy the primary variable to the star system assuming a DomainSet domain
+// -----------------------------------------------------------------------------
+void
+MPCPermafrostSplitFlux::CopyPrimaryToStar_DomainSet_()
+{
   // copy p primary variables into star primary variable
   auto p_owner = S_->GetRecord(p_primary_variable_star_, tags_[0].second).owner();
   auto& p_star = *S_->GetW<CompositeVector>(p_primary_variable_star_, tags_[0].second, p_owner)
@@ -313,24 +354,12 @@ MPCPermafrostSplitFlux::CopyPrimaryToStar_DomainSet_()
   auto& T_star = *S_->GetW<CompositeVector>(T_primary_variable_star_, tags_[0].second, T_owner)
                     .ViewComponent("cell", false);
 
-  auto ds_iter = domain_set.begin();
+  ds_p_next_.gather(p_star);
   for (int c = 0; c != p_star.MyLength(); ++c) {
-    Key p_key = Keys::getKey(*ds_iter, p_primary_variable_suffix_);
-    Tag ds_tag_next = get_ds_tag_next_(*ds_iter);
-    const auto& p = *S_->Get<CompositeVector>(p_key, ds_tag_next).ViewComponent("cell", false);
-    AMANZI_ASSERT(p.MyLength() == 1);
-    if (p[0][0] <= 101325.0) {
-      p_star[0][c] = 101325.;
-    } else {
-      p_star[0][c] = p[0][0];
-    }
-
-    Key T_key = Keys::getKey(*ds_iter, T_primary_variable_suffix_);
-    const auto& T = *S_->Get<CompositeVector>(T_key, ds_tag_next).ViewComponent("cell", false);
-    AMANZI_ASSERT(T.MyLength() == 1);
-    T_star[0][c] = T[0][0];
-    ++ds_iter;
+    if (p_star[0][c] <= 101325.0) p_star[0][c] = 101325.;
   }
+  ds_T_next_.gather(T_star);
+
   changedEvaluatorPrimary(p_primary_variable_star_, tags_[0].second, *S_);
   changedEvaluatorPrimary(T_primary_variable_star_, tags_[0].second, *S_);
 }
@@ -573,8 +602,6 @@ MPCPermafrostSplitFlux::CopyStarToPrimary_Standard_Hybrid_()
 void
 MPCPermafrostSplitFlux::CopyStarToPrimary_DomainSet_Pressure_()
 {
-  const auto& domain_set = *S_->GetDomainSet(domain_set_);
-
   // copy p primary variables into star primary variable
   const auto& p_star = *S_->GetPtr<CompositeVector>(p_primary_variable_star_, tags_[0].second)
                           ->ViewComponent("cell", false);
@@ -585,59 +612,20 @@ MPCPermafrostSplitFlux::CopyStarToPrimary_DomainSet_Pressure_()
   const auto& E_star = *S_->GetPtr<CompositeVector>(T_conserved_variable_star_, tags_[0].second)
                           ->ViewComponent("cell", false);
 
-  auto ds_iter = domain_set.begin();
   for (int c = 0; c != p_star.MyLength(); ++c) {
-    Tag ds_tag_next = get_ds_tag_next_(*ds_iter);
-    Tag ds_tag_current = get_ds_tag_current_(*ds_iter);
-
     if (p_star[0][c] > 101325.0000001) {
-      Key p_key = Keys::getKey(*ds_iter, p_primary_variable_suffix_);
-      auto p_owner = S_->GetRecord(p_key, ds_tag_current).owner();
-      auto& p =
-        *S_->GetW<CompositeVector>(p_key, ds_tag_current, p_owner).ViewComponent("cell", false);
-      AMANZI_ASSERT(p.MyLength() == 1);
-      p[0][0] = p_star[0][c];
-
-      Key WC_key = Keys::getKey(*ds_iter, p_conserved_variable_suffix_);
-      auto WC_owner = S_->GetRecord(WC_key, ds_tag_current).owner();
-      auto& WC =
-        *S_->GetW<CompositeVector>(WC_key, ds_tag_current, WC_owner).ViewComponent("cell", false);
-      AMANZI_ASSERT(WC.MyLength() == 1);
-      WC[0][0] = WC_star[0][c];
-
-      changedEvaluatorPrimary(p_key, ds_tag_current, *S_);
-      // changedEvaluatorPrimary(WC_key, ds_tag_current, *S_);
-
-      Key p_sub_key = Keys::getKey(
-        domain_sub_, Keys::getDomainSetIndex(*ds_iter), p_sub_primary_variable_suffix_);
-      auto p_sub_owner = S_->GetRecord(p_sub_key, ds_tag_current).owner();
-      CopySurfaceToSubsurface(S_->Get<CompositeVector>(p_key, ds_tag_current),
-                              S_->GetW<CompositeVector>(p_sub_key, ds_tag_current, p_sub_owner));
+      ds_p_current_[c] = p_star[0][c];
+      ds_WC_current_[c] = WC_star[0][c];
+
+      ds_p_current_.changed(c);
+      CopySurfaceToSubsurface(ds_p_current_.vector(c), ds_p_sub_current_.vector(c));
     }
 
-    Key T_key = Keys::getKey(*ds_iter, T_primary_variable_suffix_);
-    auto T_owner = S_->GetRecord(T_key, ds_tag_current).owner();
-    auto& T =
-      *S_->GetW<CompositeVector>(T_key, ds_tag_current, T_owner).ViewComponent("cell", false);
-    AMANZI_ASSERT(T.MyLength() == 1);
-    T[0][0] = T_star[0][c];
-
-    Key E_key = Keys::getKey(*ds_iter, T_conserved_variable_suffix_);
-    auto E_owner = S_->GetRecord(E_key, ds_tag_current).owner();
-    auto& E =
-      *S_->GetW<CompositeVector>(E_key, ds_tag_current, E_owner).ViewComponent("cell", false);
-    AMANZI_ASSERT(E.MyLength() == 1);
-    E[0][0] = E_star[0][c];
-
-    changedEvaluatorPrimary(T_key, ds_tag_current, *S_);
-    // changedEvaluatorPrimary(E_key, ds_tag_current, *S_);
-
-    Key T_sub_key =
-      Keys::getKey(domain_sub_, Keys::getDomainSetIndex(*ds_iter), T_sub_primary_variable_suffix_);
-    auto T_sub_owner = S_->GetRecord(T_sub_key, ds_tag_current).owner();
-    CopySurfaceToSubsurface(S_->Get<CompositeVector>(T_key, ds_tag_current),
-                            S_->GetW<CompositeVector>(T_sub_key, ds_tag_current, T_sub_owner));
-    ++ds_iter;
+    ds_T_current_[c] = T_star[0][c];
+    ds_E_current_[c] = E_star[0][c];
+
+    ds_T_current_.changed(c);
+    CopySurfaceToSubsurface(ds_T_current_.vector(c), ds_T_sub_current_.vector(c));
   }
 }
 
@@ -649,7 +637,6 @@ void
 MPCPermafrostSplitFlux::CopyStarToPrimary_DomainSet_Flux_()
 {
   double dt = S_->get_time(tag_next_) - S_->get_time(tag_current_);
-  const auto& domain_set = *S_->GetDomainSet(domain_set_);
 
   // grab the data, difference
   Epetra_MultiVector q_div(*S_->Get<CompositeVector>(p_conserved_variable_star_, tags_[0].second)
@@ -686,20 +673,8 @@ MPCPermafrostSplitFlux::CopyStarToPrimary_DomainSet_Flux_()
     0.);
 
   // copy into columns
-  auto ds_iter = domain_set.begin();
-  for (int c = 0; c != q_div.MyLength(); ++c) {
-    Tag ds_tag_next = get_ds_tag_next_(*ds_iter);
-    Key p_key = Keys::getKey(*ds_iter, p_lateral_flow_source_suffix_);
-    (*S_->GetW<CompositeVector>(p_key, ds_tag_next, name_).ViewComponent("cell", false))[0][0] =
-      q_div[0][c];
-    changedEvaluatorPrimary(p_key, ds_tag_next, *S_);
-
-    Key T_key = Keys::getKey(*ds_iter, T_lateral_flow_source_suffix_);
-    (*S_->GetW<CompositeVector>(T_key, ds_tag_next, name_).ViewComponent("cell", false))[0][0] =
-      qE_div[0][c];
-    changedEvaluatorPrimary(T_key, ds_tag_next, *S_);
-    ++ds_iter;
-  }
+  ds_q_next_.scatter(q_div);
+  ds_qE_next_.scatter(qE_div);
 }
 
 
@@ -710,7 +685,6 @@ void
 MPCPermafrostSplitFlux::CopyStarToPrimary_DomainSet_Hybrid_()
 {
   double dt = S_->get_time(tag_next_) - S_->get_time(tag_current_);
-  const auto& domain_set = *S_->GetDomainSet(domain_set_);
 
   // grab the data, difference
   Epetra_MultiVector q_div(*S_->Get<CompositeVector>(p_conserved_variable_star_, tags_[0].second)
@@ -757,84 +731,33 @@ MPCPermafrostSplitFlux::CopyStarToPrimary_DomainSet_Hybrid_()
                           ->ViewComponent("cell", false);
 
   // in the case of water loss, use pressure.  in the case of water gain, use flux.
-  auto ds_iter = domain_set.begin();
   for (int c = 0; c != p_star.MyLength(); ++c) {
-    Tag ds_tag_next = get_ds_tag_next_(*ds_iter);
-    Tag ds_tag_current = get_ds_tag_current_(*ds_iter);
-
     if (p_star[0][c] > 101325. && q_div[0][c] < 0.) {
       // use the Dirichlet
-      Key p_key = Keys::getKey(*ds_iter, p_primary_variable_suffix_);
-      auto p_owner = S_->GetRecord(p_key, ds_tag_current).owner();
-      auto& p =
-        *S_->GetW<CompositeVector>(p_key, ds_tag_current, p_owner).ViewComponent("cell", false);
-      AMANZI_ASSERT(p.MyLength() == 1);
-      p[0][0] = p_star[0][c];
-
-      Key WC_key = Keys::getKey(*ds_iter, p_conserved_variable_suffix_);
-      auto WC_owner = S_->GetRecord(WC_key, ds_tag_current).owner();
-      auto& WC =
-        *S_->GetW<CompositeVector>(WC_key, ds_tag_current, WC_owner).ViewComponent("cell", false);
-      AMANZI_ASSERT(WC.MyLength() == 1);
-      WC[0][0] = WC_star[0][c];
-
-      changedEvaluatorPrimary(p_key, ds_tag_current, *S_);
-      // changedEvaluatorPrimary(WC_key, ds_tag_current, *S_);
-
-      Key p_sub_key = Keys::getKey(
-        domain_sub_, Keys::getDomainSetIndex(*ds_iter), p_sub_primary_variable_suffix_);
-      auto p_sub_owner = S_->GetRecord(p_sub_key, ds_tag_current).owner();
-      CopySurfaceToSubsurface(S_->Get<CompositeVector>(p_key, ds_tag_current),
-                              S_->GetW<CompositeVector>(p_sub_key, ds_tag_current, p_sub_owner));
-
-      Key T_key = Keys::getKey(*ds_iter, T_primary_variable_suffix_);
-      auto T_owner = S_->GetRecord(T_key, ds_tag_current).owner();
-      auto& T =
-        *S_->GetW<CompositeVector>(T_key, ds_tag_current, T_owner).ViewComponent("cell", false);
-      AMANZI_ASSERT(T.MyLength() == 1);
-      T[0][0] = T_star[0][c];
-
-      Key E_key = Keys::getKey(*ds_iter, T_conserved_variable_suffix_);
-      auto E_owner = S_->GetRecord(E_key, ds_tag_current).owner();
-      auto& E =
-        *S_->GetW<CompositeVector>(E_key, ds_tag_current, E_owner).ViewComponent("cell", false);
-      AMANZI_ASSERT(E.MyLength() == 1);
-      E[0][0] = E_star[0][c];
-
-      changedEvaluatorPrimary(T_key, ds_tag_current, *S_);
-      // changedEvaluatorPrimary(E_key, ds_tag_current, *S_);
-
-      Key T_sub_key = Keys::getKey(
-        domain_sub_, Keys::getDomainSetIndex(*ds_iter), T_sub_primary_variable_suffix_);
-      auto T_sub_owner = S_->GetRecord(T_sub_key, ds_tag_current).owner();
-      CopySurfaceToSubsurface(S_->Get<CompositeVector>(T_key, ds_tag_current),
-                              S_->GetW<CompositeVector>(T_sub_key, ds_tag_current, T_sub_owner));
+      ds_p_current_[c] = p_star[0][c];
+      ds_WC_current_[c] = WC_star[0][c];
 
-      // set the lateral flux to 0
-      Key p_lf_key = Keys::getKey(*ds_iter, p_lateral_flow_source_suffix_);
-      (*S_->GetW<CompositeVector>(p_lf_key, ds_tag_next, name_)
-          .ViewComponent("cell", false))[0][0] = 0.;
-      changedEvaluatorPrimary(p_lf_key, ds_tag_next, *S_);
+      ds_p_current_.changed(c);
+      CopySurfaceToSubsurface(ds_p_current_.vector(c), ds_p_sub_current_.vector(c));
+
+      ds_T_current_[c] = T_star[0][c];
+      ds_E_current_[c] = E_star[0][c];
 
-      Key T_lf_key = Keys::getKey(*ds_iter, T_lateral_flow_source_suffix_);
-      (*S_->GetW<CompositeVector>(T_lf_key, ds_tag_next, name_)
-          .ViewComponent("cell", false))[0][0] = 0.;
-      changedEvaluatorPrimary(T_lf_key, ds_tag_next, *S_);
+      ds_T_current_.changed(c);
+      CopySurfaceToSubsurface(ds_T_current_.vector(c), ds_T_sub_current_.vector(c));
+
+      // set the lateral flux to 0
+      ds_q_next_[c] = 0.;
+      ds_qE_next_[c] = 0.;
 
     } else {
       // use flux
-      Key p_key = Keys::getKey(*ds_iter, p_lateral_flow_source_suffix_);
-      (*S_->GetW<CompositeVector>(p_key, ds_tag_next, name_).ViewComponent("cell", false))[0][0] =
-        q_div[0][c];
-      changedEvaluatorPrimary(p_key, ds_tag_next, *S_);
-
-      Key T_key = Keys::getKey(*ds_iter, T_lateral_flow_source_suffix_);
-      (*S_->GetW<CompositeVector>(T_key, ds_tag_next, name_).ViewComponent("cell", false))[0][0] =
-        qE_div[0][c];
-      changedEvaluatorPrimary(T_key, ds_tag_next, *S_);
+      ds_q_next_[c] = q_div[0][c];
+      ds_qE_next_[c] = qE_div[0][c];
     }
-    ++ds_iter;
   }
+  ds_q_next_.changedAll();
+  ds_qE_next_.changedAll();
 }
 
 
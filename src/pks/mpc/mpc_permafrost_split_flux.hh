@@ -64,6 +64,7 @@ Note that this can be used with either a 3D subsurface solve, by setting the
 
 #include "PK.hh"
 #include "mpc_subcycled.hh"
+#include "domain_set_exchange.hh"
 
 namespace Amanzi {
 
@@ -87,6 +88,7 @@ class MPCPermafrostSplitFlux : public MPCSubcycled {
   void CopyPrimaryToStar_();
   void CopyStarToPrimary_();
 
+  void ResolveDomainSet_();
   void CopyPrimaryToStar_DomainSet_();
   void CopyStarToPrimary_DomainSet_Pressure_();
   void CopyStarToPrimary_DomainSet_Flux_();
@@ -154,6 +156,12 @@ class MPCPermafrostSplitFlux : public MPCSubcycled {
 
   bool is_domain_set_;
 
+  // per-subdomain records, resolved once in Initialize()
+  DomainSetExchange ds_p_next_, ds_T_next_;
+  DomainSetExchange ds_p_current_, ds_WC_current_, ds_T_current_, ds_E_current_;
+  DomainSetExchange ds_p_sub_current_, ds_T_sub_current_;
+  DomainSetExchange ds_q_next_, ds_qE_next_;
+
  private:
   // factory registration
   static RegisteredPKFactory<MPCPermafrostSplitFlux> reg_;
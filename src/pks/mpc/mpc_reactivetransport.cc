@@ -35,6 +35,14 @@ MPCReactiveTransport::MPCReactiveTransport(Teuchos::ParameterList& pk_tree,
   tcc_key_ = Keys::readKey(
     *plist_, domain_, "total component concentration", "total_component_concentration");
   mol_dens_key_ = Keys::readKey(*plist_, domain_, "molar density liquid", "molar_density_liquid");
+
+  double skip_rtol = plist_->get<double>("chemistry skip relative tolerance", -1.);
+  if (skip_rtol > 0.) {
+    temp_key_ = Keys::readKey(*plist_, domain_, "temperature", "temperature");
+    wc_key_ = Keys::readKey(*plist_, domain_, "water content", "water_content");
+    double max_interval = plist_->get<double>("chemistry skip maximum interval [s]", 86400.);
+    chem_change_ = Teuchos::rcp(new ChemistryChangeDetector(skip_rtol, max_interval));
+  }
 }
 
 
@@ -59,6 +67,15 @@ MPCReactiveTransport::Setup()
     ->SetGhosted()
     ->AddComponent("cell", AmanziMesh::Entity_kind::CELL, 1);
   S_->RequireEvaluator(mol_dens_key_, tag_next_);
+
+  if (chem_change_ != Teuchos::null) {
+    for (const auto& key : { temp_key_, wc_key_ }) {
+      S_->Require<CompositeVector, CompositeVectorSpace>(key, tag_next_)
+        .SetMesh(S_->GetMesh(domain_))
+        ->AddComponent("cell", AmanziMesh::Entity_kind::CELL, 1);
+      S_->RequireEvaluator(key, tag_next_);
+    }
+  }
 }
 
 void
@@ -141,12 +158,61 @@ MPCReactiveTransport::AdvanceStep(double t_old, double t_new, bool reinit)
   Teuchos::RCP<const Epetra_MultiVector> mol_dens =
     S_->Get<CompositeVector>(mol_dens_key_, tag_next_).ViewComponent("cell", true);
 
-  fail |=
-    advanceChemistry(chemistry_pk_, t_old, t_new, reinit, *mol_dens, tcc_copy, *alquimia_timer_);
+  // skip the solve if no inputs have changed since the last one, keeping the
+  // current concentrations
+  if (chem_change_ != Teuchos::null && !reinit) {
+    S_->GetEvaluator(temp_key_, tag_next_).Update(*S_, name_);
+    S_->GetEvaluator(wc_key_, tag_next_).Update(*S_, name_);
+    const Epetra_MultiVector& temp =
+      *S_->Get<CompositeVector>(temp_key_, tag_next_).ViewComponent("cell", false);
+    const Epetra_MultiVector& wc =
+      *S_->Get<CompositeVector>(wc_key_, tag_next_).ViewComponent("cell", false);
+    bool skip = chem_change_->IsQuiescent(*tcc_copy, temp, wc, t_new);
+
+    if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+      *vo_->os() << "Chemistry: " << chem_change_->num_quiescent_cells() << " of "
+                 << chem_change_->num_cells() << " cells unchanged, "
+                 << (skip ? "skipping" : "solving") << " (skipped " << chem_change_->num_skipped()
+                 << ", solved " << chem_change_->num_solved() << ")" << std::endl;
+    }
+    if (skip) {
+      changedEvaluatorPrimary(tcc_key_, tag_next_, *S_);
+      chem_step_succeeded_ = true;
+      return fail;
+    }
+  }
+
+  // integrate over any skipped steps as well
+  double t_chem_old = t_old;
+  if (chem_change_ != Teuchos::null && !reinit) t_chem_old = chem_change_->SolveStartTime(t_old);
+
+  fail |= advanceChemistry(
+    chemistry_pk_, t_chem_old, t_new, reinit, *mol_dens, tcc_copy, *alquimia_timer_);
+  if (fail && chem_change_ != Teuchos::null) {
+    // the retry solves from t_old, even if this was a catch-up solve
+    chem_change_->FailStep(t_old);
+  } else if (chem_change_ != Teuchos::null) {
+    chem_change_->Record(
+      *tcc_copy,
+      *S_->Get<CompositeVector>(temp_key_, tag_next_).ViewComponent("cell", false),
+      *S_->Get<CompositeVector>(wc_key_, tag_next_).ViewComponent("cell", false),
+      t_new);
+  }
   changedEvaluatorPrimary(tcc_key_, tag_next_, *S_);
   if (!fail) chem_step_succeeded_ = true;
   return fail;
 };
 
 
+// -----------------------------------------------------------------------------
+// Fail the sub-PKs, and restart any chemistry catch-up at t_old.
+// -----------------------------------------------------------------------------
+void
+MPCReactiveTransport::FailStep(double t_old, double t_new, const Tag& tag)
+{
+  WeakMPC::FailStep(t_old, t_new, tag);
+  if (chem_change_ != Teuchos::null) chem_change_->FailStep(t_old);
+}
+
+
 } // namespace Amanzi
@@ -11,6 +11,17 @@
   This is the mpc_pk component of the Amanzi code.
 
   Process kernel for coupling of Transport_PK and Chemistry_PK.
+
+  If "chemistry skip relative tolerance" is positive (default -1, off), the
+  chemistry solve is skipped when, in every cell, total component
+  concentration, temperature ("temperature" key) and water content ("water
+  content" key) are all within this relative tolerance of their values at the
+  last solve.  A solve is forced once "chemistry skip maximum interval [s]"
+  (default 86400) has passed since the last one, and each solve integrates
+  the chemistry from the end of the last solve, so kinetic reactions are
+  delayed by at most that interval rather than dropped.  If a step fails,
+  its retry integrates only from the start of that step, so that a cut step
+  also cuts the chemistry interval; the skipped time is dropped.
 */
 
 
@@ -23,6 +34,7 @@
 #include "transport_ats.hh"
 #include "Chemistry_PK.hh"
 #include "weak_mpc.hh"
+#include "pk_helpers.hh"
 
 namespace Amanzi {
 
@@ -38,6 +50,7 @@ class MPCReactiveTransport : public WeakMPC {
   virtual void Setup() override;
   virtual void Initialize() override;
   virtual bool AdvanceStep(double t_old, double t_new, bool reinit = false) override;
+  virtual void FailStep(double t_old, double t_new, const Tag& tag) override;
 
  protected:
   virtual void cast_sub_pks_();
@@ -48,9 +61,12 @@ class MPCReactiveTransport : public WeakMPC {
   Key domain_;
   Key tcc_key_;
   Key mol_dens_key_;
+  Key temp_key_, wc_key_;
 
   Teuchos::RCP<Teuchos::Time> alquimia_timer_;
 
+  Teuchos::RCP<ChemistryChangeDetector> chem_change_;
+
   // storage for the component concentration intermediate values
   Teuchos::RCP<Transport::Transport_ATS> transport_pk_;
   Teuchos::RCP<AmanziChemistry::Chemistry_PK> chemistry_pk_;
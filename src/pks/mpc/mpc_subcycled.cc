@@ -42,6 +42,10 @@ MPCSubcycled::MPCSubcycled(Teuchos::ParameterList& pk_tree,
 
   // min dt allowed in subcycling
   target_dt_ = plist_->get<double>("subcycling target time step [s]", -1);
+
+  // keys computed once per outer step and shared with the inner tags
+  shared_keys_ = plist_->get<Teuchos::Array<std::string>>("subcycling shared keys",
+                                                         Teuchos::Array<std::string>());
 }
 
 
@@ -74,7 +78,15 @@ MPCSubcycled::Setup()
     S_->require_time(tag.first);
     S_->require_time(tag.second);
     S_->require_cycle(tag.second);
-    if (subcycling_[i]) S_->Require<double>("dt", tag.first, name());
+    if (subcycling_[i]) {
+      S_->Require<double>("dt", tag.first, name());
+
+      // share before the sub-PKs require these at their own tags
+      for (const auto& key : shared_keys_) {
+        requireAliasedEvaluator(*S_, key, tag_current_, tag.first);
+        requireAliasedEvaluator(*S_, key, tag_next_, tag.second);
+      }
+    }
     ++i;
   }
   MPC<PK>::Setup();
@@ -14,6 +14,12 @@
   * `"minimum subcycled relative dt`" ``[double]`` **1.e-5** Sets the minimum
     time step size of the subcycled PKs, as a multiple of the minimum of the
     non-subcycled PKs' timestep sizes.
+  * `"subcycling shared keys`" ``[Array(string)]`` **empty** Secondary
+    variables which are constant over a step of the non-subcycled PKs, e.g.
+    those that depend only on their fields.  These are evaluated once, at the
+    outer tags, and shared with the subcycled PKs' inner tags rather than being
+    re-evaluated at each inner tag.  These may not be primary variables of the
+    subcycled PKs.
 
   INCLUDES:
   - ``[mpc-spec]``
@@ -56,6 +62,7 @@ class MPCSubcycled : public MPC<PK> {
   double dt_, target_dt_;
   std::vector<double> dts_;
   std::vector<std::pair<Tag, Tag>> tags_;
+  Teuchos::Array<std::string> shared_keys_;
 
  private:
   // factory registration
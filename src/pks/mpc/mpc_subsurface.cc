@@ -151,6 +151,8 @@ MPCSubsurface::Setup()
     precon_type_ = PRECON_NO_FLOW_COUPLING;
   } else if (precon_string == "picard") {
     precon_type_ = PRECON_PICARD;
+  } else if (precon_string == "cpr") {
+    precon_type_ = PRECON_CPR;
   } else if (precon_string == "ewc") {
     AMANZI_ASSERT(0);
     precon_type_ = PRECON_EWC;
@@ -383,7 +385,29 @@ MPCSubsurface::Setup()
     preconditioner_->set_operator_block(1, 0, dE_dp_block_);
 
     // set up sparsity structure
-    preconditioner_->set_inverse_parameters(plist_->sublist("inverse"));
+    if (precon_type_ == PRECON_CPR) {
+      // -- stage 1: the flow PK's operator with a (typically AMG) inverse
+      Teuchos::ParameterList& pres_inv_list = plist_->sublist("cpr pressure inverse");
+      if (!pres_inv_list.isParameter("preconditioning method"))
+        pres_inv_list.set<std::string>("preconditioning method", "boomer amg");
+      pcA->set_inverse_parameters(pres_inv_list);
+
+      // -- stage 2: a cheap smoother on the full coupled system
+      Teuchos::ParameterList& smoother_inv_list = plist_->sublist("cpr smoother inverse");
+      if (!smoother_inv_list.isParameter("preconditioning method"))
+        smoother_inv_list.set<std::string>("preconditioning method", "block ilu");
+      preconditioner_->set_inverse_parameters(smoother_inv_list);
+    } else if (Operators::isPipelinedKrylov(plist_->sublist("inverse"))) {
+      // the TreeOperator's inverse is only the preconditioner of the
+      // pipelined method
+      preconditioner_->set_inverse_parameters(
+        Operators::preconditionerOnly(plist_->sublist("inverse")));
+      pipelined_inverse_ = Teuchos::rcp(new Operators::PipelinedKrylov<Operators::TreeOperator,
+                                                                       TreeVector>(
+        plist_->sublist("inverse"), preconditioner_));
+    } else {
+      preconditioner_->set_inverse_parameters(plist_->sublist("inverse"));
+    }
   }
 
   // create the EWC delegate
@@ -526,7 +550,8 @@ MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
     // nothing to do
   } else if (precon_type_ == PRECON_BLOCK_DIAGONAL) {
     StrongMPC::UpdatePreconditioner(t, up, h);
-  } else if (precon_type_ == PRECON_PICARD || precon_type_ == PRECON_EWC) {
+  } else if (precon_type_ == PRECON_PICARD || precon_type_ == PRECON_EWC ||
+             precon_type_ == PRECON_CPR) {
     preconditioner_->InitOffdiagonals(); // zero out offdiagonal blocks and mark for re-computation
     StrongMPC::UpdatePreconditioner(t, up, h);
 
@@ -750,10 +775,20 @@ MPCSubsurface::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RC
     ierr = 1;
   } else if (precon_type_ == PRECON_BLOCK_DIAGONAL) {
     ierr = StrongMPC::ApplyPreconditioner(u, Pu);
+  } else if (pipelined_inverse_ != Teuchos::null &&
+             (precon_type_ == PRECON_PICARD || precon_type_ == PRECON_EWC)) {
+    Pu->PutScalar(0.);
+    ierr = pipelined_inverse_->ApplyInverse(*u, *Pu);
+    if (vo_->os_OK(Teuchos::VERB_HIGH))
+      *vo_->os() << "  pipelined Krylov: " << pipelined_inverse_->returned_code_string() << " in "
+                 << pipelined_inverse_->num_itrs() << " itrs, residual "
+                 << pipelined_inverse_->residual() << std::endl;
   } else if (precon_type_ == PRECON_PICARD) {
     ierr = preconditioner_->ApplyInverse(*u, *Pu);
   } else if (precon_type_ == PRECON_EWC) {
     ierr = preconditioner_->ApplyInverse(*u, *Pu);
+  } else if (precon_type_ == PRECON_CPR) {
+    ierr = ApplyPreconditionerCPR_(u, Pu);
   }
 
   if (vo_->os_OK(Teuchos::VERB_HIGH)) {
@@ -770,4 +805,60 @@ MPCSubsurface::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RC
   return (ierr > 0) ? 0 : 1;
 }
 
+
+// -----------------------------------------------------------------------------
+// Two-stage, constrained pressure residual preconditioner.
+//
+// Stage 1: solve the decoupled pressure system,
+//     A_pp dp = r_p - w r_T,   w = (dWC/dT) / (dE/dT)
+// where the quasi-IMPES weights w eliminate the cell-local temperature
+// dependence of the water residual.
+//
+// Stage 2: smooth the full coupled system on the remaining residual,
+//     Pu = x1 + M^-1 (r - A x1),   x1 = [dp, 0]
+// -----------------------------------------------------------------------------
+int
+MPCSubsurface::ApplyPreconditionerCPR_(Teuchos::RCP<const TreeVector> u,
+                                       Teuchos::RCP<TreeVector> Pu)
+{
+  if (cpr_res_ == Teuchos::null) {
+    cpr_res_ = Teuchos::rcp(new TreeVector(*u));
+    cpr_Pu_ = Teuchos::rcp(new TreeVector(*Pu));
+  }
+
+  // -- form the decoupled pressure residual
+  *cpr_res_ = *u;
+  if (S_->HasDerivative(wc_key_, tag_next_, temp_key_, tag_next_) &&
+      S_->HasDerivative(e_key_, tag_next_, temp_key_, tag_next_)) {
+    const Epetra_MultiVector& dWC_dT =
+      *S_->GetDerivative<CompositeVector>(wc_key_, tag_next_, temp_key_, tag_next_)
+         .ViewComponent("cell", false);
+    const Epetra_MultiVector& dE_dT =
+      *S_->GetDerivative<CompositeVector>(e_key_, tag_next_, temp_key_, tag_next_)
+         .ViewComponent("cell", false);
+    const Epetra_MultiVector& r_T = *u->SubVector(1)->Data()->ViewComponent("cell", false);
+    Epetra_MultiVector& r_p = *cpr_res_->SubVector(0)->Data()->ViewComponent("cell", false);
+
+    for (int c = 0; c != r_p.MyLength(); ++c) {
+      if (std::abs(dE_dT[0][c]) > 0.) r_p[0][c] -= dWC_dT[0][c] / dE_dT[0][c] * r_T[0][c];
+    }
+  }
+
+  // -- stage 1: pressure solve
+  Pu->PutScalar(0.);
+  int ierr = sub_pks_[0]->preconditioner()->ApplyInverse(*cpr_res_->SubVector(0)->Data(),
+                                                          *Pu->SubVector(0)->Data());
+
+  // -- stage 2: smooth the coupled residual, r - A x1
+  preconditioner_->Apply(*Pu, *cpr_res_);
+  cpr_res_->Update(1., *u, -1.);
+  int ierr2 = preconditioner_->ApplyInverse(*cpr_res_, *cpr_Pu_);
+  Pu->Update(1., *cpr_Pu_, 1.);
+
+  if (vo_->os_OK(Teuchos::VERB_EXTREME))
+    *vo_->os() << "CPR stage returns: pressure = " << ierr << ", smoother = " << ierr2
+               << std::endl;
+  return std::min(ierr, ierr2);
+}
+
 } // namespace Amanzi
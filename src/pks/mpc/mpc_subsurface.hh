@@ -104,6 +104,18 @@ except in expert cases or for comparison's sake, but the options are:
   hope.
 
 
+- `"cpr`" A two-stage, constrained pressure residual preconditioner.  This
+  assembles the same blocks as `"picard`", but rather than inverting the full
+  coupled system (typically with AMG), it first solves a decoupled pressure
+  system, then applies a cheap smoother to the full coupled system on the
+  remaining residual.  The pressure system is formed by eliminating the
+  cell-local temperature dependence of the water residual using the ratio of
+  accumulation terms, :math:`\frac{\partial \Theta}{\partial T} /
+  \frac{\partial E}{\partial T}`, and is solved using the flow PK's operator
+  and the `"cpr pressure inverse`".  The smoother is given by the `"cpr
+  smoother inverse`".  This is typically more scalable and uses less memory
+  than AMG on the full system.
+
 Note this "ewc" algorithm is just as valid, and more useful, in the predictor
 (where it is not deprecated/disabled).  There, we extrapolate a change in
 pressure and temperature, but often do better to extrapolate in water content
@@ -118,12 +130,26 @@ algorithms are supported by the `EWC Globalization Delegate`_ object.
 
     * `"preconditioner type`" ``[string]`` **picard** See the above for
       detailed descriptions of the choices.  One of: `"none`", `"block
-      diagonal`", `"no flow coupling`", `"picard`", `"ewc`", and `"smart ewc`".
+      diagonal`", `"no flow coupling`", `"picard`", `"cpr`", `"ewc`", and `"smart ewc`".
 
     * `"supress Jacobian terms: div hq / dp,T`" ``[bool]`` **false** If using picard or ewc, do not include this block in the preconditioner.
     * `"supress Jacobian terms: d div q / dT`" ``[bool]`` **false** If using picard or ewc, do not include this block in the preconditioner.
     * `"supress Jacobian terms: d div K grad T / dp`" ``[bool]`` **false** If using picard or ewc, do not include this block in the preconditioner.
 
+    * `"cpr pressure inverse`" ``[inverse-typed-spec]`` **boomer amg**
+      Only used with `"cpr`", the inverse applied to the decoupled pressure
+      system in the first stage.
+
+    * `"cpr smoother inverse`" ``[inverse-typed-spec]`` **block ilu**
+      Only used with `"cpr`", the inverse applied to the full coupled system
+      in the second stage.
+
+    * `"inverse`" ``[inverse-typed-spec]`` **optional** Used with `"picard`"
+      and `"ewc`", the inverse of the coupled system.  This may use
+      `"pipelined gmres`" as its `"iterative method`", see
+      `iterative-method-pipelined-spec`_, which wraps the `"preconditioning
+      method`" in a GMRES with one global reduction per iteration.
+
     * `"ewc delegate`" ``[mpc-delegate-ewc-spec]`` A `EWC Globalization Delegate`_ spec.
 
     INCLUDES:
@@ -136,6 +162,7 @@ algorithms are supported by the `EWC Globalization Delegate`_ object.
 #define MPC_SUBSURFACE_HH_
 
 #include "TreeOperator.hh"
+#include "pipelined_krylov.hh"
 #include "pk_physical_bdf_default.hh"
 #include "strong_mpc.hh"
 
@@ -193,8 +220,12 @@ class MPCSubsurface : public StrongMPC<PK_PhysicalBDF_Default> {
     PRECON_PICARD = 2,
     PRECON_EWC = 3,
     PRECON_NO_FLOW_COUPLING = 4,
+    PRECON_CPR = 5,
   };
 
+  // two-stage, constrained pressure residual preconditioner
+  int ApplyPreconditionerCPR_(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu);
+
   Teuchos::RCP<Operators::TreeOperator> preconditioner_;
   Teuchos::RCP<const AmanziMesh::Mesh> mesh_;
 
@@ -255,6 +286,13 @@ class MPCSubsurface : public StrongMPC<PK_PhysicalBDF_Default> {
 
   bool is_fv_;
 
+  // CPR workspace
+  Teuchos::RCP<TreeVector> cpr_res_;
+  Teuchos::RCP<TreeVector> cpr_Pu_;
+
+  // pipelined Krylov inverse, if requested
+  Teuchos::RCP<Operators::PipelinedKrylov<Operators::TreeOperator, TreeVector>> pipelined_inverse_;
+
   // EWC delegate
   Teuchos::RCP<MPCDelegateEWCSubsurface> ewc_;
 
@@ -20,9 +20,16 @@ subcycled.  That seems appropriate as this means to couple PKs of the same type
 but not all?  That could be generalized, but it would be tricky to define on an
 input spec.
 
+When subcycling, `"subcycling shared variables`" ``[Array(string)]`` lists
+secondary variables, by variable name without domain, which are constant over
+the outer step.  In each subdomain these are evaluated once at the outer tags
+and shared with the subdomain's inner tags, rather than re-evaluated at each
+inner tag.
+
 */
 
 
+#include "pk_helpers.hh"
 #include "mpc_weak_subdomain.hh"
 
 
@@ -41,6 +48,8 @@ MPCWeakSubdomain::MPCWeakSubdomain(Teuchos::ParameterList& FElist,
   subcycled_ = plist_->template get<bool>("subcycle", false);
   if (subcycled_) {
     subcycled_target_dt_ = plist_->template get<double>("subcycling target time step [s]");
+    shared_variables_ = plist_->template get<Teuchos::Array<std::string>>(
+      "subcycling shared variables", Teuchos::Array<std::string>());
   }
 };
 
@@ -114,6 +123,13 @@ MPCWeakSubdomain::Setup()
       S_->require_time(tag_subcycle_next);
       S_->require_cycle(tag_subcycle_next);
       S_->Require<double>("dt", tag_subcycle_next, name());
+
+      // share before the sub-PKs require these at their own tags
+      for (const auto& var : shared_variables_) {
+        Key key = Keys::getKey(subdomain, var);
+        requireAliasedEvaluator(*S_, key, tag_current_, tag_subcycle_current);
+        requireAliasedEvaluator(*S_, key, tag_next_, tag_subcycle_next);
+      }
     }
   }
   MPC<PK>::Setup();
@@ -67,6 +67,7 @@ class MPCWeakSubdomain : public MPC<PK> {
   double subcycled_target_dt_;
   double cycle_dt_;
   Key ds_name_;
+  Teuchos::Array<std::string> shared_variables_;
 
  private:
   // factory registration
@@ -67,6 +67,9 @@ class StrongMPC : public MPC<PK_t>, public PK_BDF_Default {
   // -- enorm for the coupled system
   virtual double
   ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> du) override;
+  virtual void ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                              Teuchos::RCP<const TreeVector> du,
+                              ErrorNormAccumulator& enorm) override;
 
   // StrongMPC's preconditioner is, by default, just the block-diagonal
   // operator formed by placing the sub PK's preconditioners on the diagonal.
@@ -268,14 +271,32 @@ StrongMPC<PK_t>::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::
 
 // -----------------------------------------------------------------------------
 // Compute a norm on u-du and returns the result.
-// For a Strong MPC, the enorm is just the max of the sub PKs enorms.
+// For a Strong MPC, the enorm is just the max of the sub PKs enorms.  All
+// local contributions across the tree are gathered first, then reduced once.
 // -----------------------------------------------------------------------------
 template <class PK_t>
 double
 StrongMPC<PK_t>::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> du)
 {
-  double norm = 0.0;
+  ErrorNormAccumulator enorm;
+  ErrorNormLocal(u, du, enorm);
+  double norm = enorm.Reduce(*solution_->Comm());
 
+  Teuchos::OSTab tab = vo_->getOSTab();
+  if (vo_->os_OK(Teuchos::VERB_MEDIUM)) enorm.Write(*vo_);
+  return norm;
+};
+
+
+// -----------------------------------------------------------------------------
+// Gather rank-local error norm contributions from each sub-PK.
+// -----------------------------------------------------------------------------
+template <class PK_t>
+void
+StrongMPC<PK_t>::ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                                Teuchos::RCP<const TreeVector> du,
+                                ErrorNormAccumulator& enorm)
+{
   // loop over sub-PKs
   for (std::size_t i = 0; i != sub_pks_.size(); ++i) {
     // pull out the u sub-vector
@@ -292,11 +313,8 @@ StrongMPC<PK_t>::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const
       Exceptions::amanzi_throw(message);
     }
 
-    // norm is the max of the sub-PK norms
-    double tmp_norm = sub_pks_[i]->ErrorNorm(pk_u, pk_du);
-    norm = std::max(norm, tmp_norm);
+    sub_pks_[i]->ErrorNormLocal(pk_u, pk_du, enorm);
   }
-  return norm;
 };
 
 
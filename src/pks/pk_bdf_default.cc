@@ -62,6 +62,7 @@ PK_BDF_Default::Initialize()
     bdf_plist.sublist("verbose object")
       .setParametersNotAlreadySet(plist_->sublist("verbose object"));
     bdf_plist.sublist("verbose object").set("name", name() + "_TI");
+    if (plist_->isSublist("Jacobian-free Newton-Krylov")) SetupJFNK_(bdf_plist);
 
     time_stepper_ =
       Teuchos::rcp(new BDF1_TI<TreeVector, TreeVectorSpace>(*this, bdf_plist, solution_, S_));
@@ -86,6 +87,48 @@ PK_BDF_Default::Initialize()
 };
 
 
+// -----------------------------------------------------------------------------
+// Rewrites the time integrator's solver list to use JFNK, with the
+// originally requested solver as the outer nonlinear solver.
+// -----------------------------------------------------------------------------
+void
+PK_BDF_Default::SetupJFNK_(Teuchos::ParameterList& bdf_plist)
+{
+  std::string solver_type = bdf_plist.get<std::string>("solver type", "nka");
+  if (solver_type == "JFNK") return; // user did this by hand
+
+  Teuchos::ParameterList& jfnk_plist = plist_->sublist("Jacobian-free Newton-Krylov");
+  Teuchos::ParameterList& jf_solver_plist = bdf_plist.sublist("JFNK parameters");
+
+  // -- the outer nonlinear solver
+  Teuchos::ParameterList& nl_plist = jf_solver_plist.sublist("nonlinear solver");
+  nl_plist.set("solver type", solver_type);
+  nl_plist.set(solver_type + " parameters", bdf_plist.sublist(solver_type + " parameters"));
+
+  // -- the Krylov method, preconditioned by ApplyPreconditioner()
+  Teuchos::ParameterList& inv_plist = jf_solver_plist.sublist("inverse");
+  inv_plist.setParameters(jfnk_plist.sublist("inverse"));
+  if (!inv_plist.isParameter("iterative method")) {
+    inv_plist.set<std::string>("iterative method", "gmres");
+    Teuchos::ParameterList& gmres_plist = inv_plist.sublist("gmres parameters");
+    gmres_plist.set<double>("error tolerance", 1.e-4);
+    gmres_plist.set<int>("maximum number of iterations", 20);
+  }
+  inv_plist.sublist("verbose object").setParametersNotAlreadySet(plist_->sublist("verbose object"));
+
+  // -- finite difference options
+  jf_solver_plist.set("JF matrix parameters", jfnk_plist.sublist("JF matrix parameters"));
+
+  bdf_plist.set<std::string>("solver type", "JFNK");
+
+  if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    *vo_->os() << "Using Jacobian-free Newton-Krylov with outer solver \"" << solver_type << "\""
+               << std::endl;
+  }
+}
+
+
 // -----------------------------------------------------------------------------
 // Initialization of timestepper.
 // -----------------------------------------------------------------------------
@@ -30,10 +30,30 @@ PKs.
     * `"inverse`" ``[inverse-typed-spec]`` **optional** A Preconditioner_.
       Note that this is only used if this PK is not strongly coupled to other PKs.
 
+    * `"Jacobian-free Newton-Krylov`" ``[jfnk-option-spec]`` **optional** If
+      provided, the nonlinear solver given in the `"time integrator`" list is
+      wrapped in a `Solver: Jacobian-Free Newton Krylov`_.  The action of the
+      Jacobian is then computed by finite differencing FunctionalResidual() of
+      this PK (and, for an MPC, its entire tree), and the PK's existing
+      ApplyPreconditioner() is used as the preconditioner of the Krylov
+      method.  This recovers true Newton convergence (e.g. including the dkr/dT
+      terms not available to approximate Jacobians) at the cost of one
+      additional residual evaluation per Krylov iteration.  Note that this is
+      only used if this PK is not strongly coupled to other PKs.
+
     INCLUDES:
 
     - ``[pk-spec]`` This *is a* PK_.
 
+.. _jfnk-option-spec:
+.. admonition:: jfnk-option-spec
+
+    * `"inverse`" ``[inverse-typed-spec]`` **gmres** The Krylov method used
+      to approximate the Newton correction.  Defaults to GMRES with a loose
+      tolerance.
+
+    * `"JF matrix parameters`" ``[jf-matrix-spec]`` **optional** Options
+      controlling the finite difference epsilon, see jf-matrix-spec_.
 
 */
 
@@ -47,6 +67,8 @@ PKs.
 #include "BDF1_TI.hh"
 #include "PK_BDF.hh"
 
+#include "error_norm_accumulator.hh"
+
 
 namespace Amanzi {
 
@@ -83,6 +105,16 @@ class PK_BDF_Default : public PK_BDF {
   // update the continuation parameter
   virtual void UpdateContinuationParameter(double lambda) override;
 
+  // -- Add rank-local contributions to the error norm.  Trees of PKs gather
+  //    all contributions before doing a single reduction.  The default
+  //    simply calls ErrorNorm(), which does its own reduction.
+  virtual void ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                              Teuchos::RCP<const TreeVector> du,
+                              ErrorNormAccumulator& enorm)
+  {
+    enorm.Add(name(), "all", ErrorNorm(u, du), -1, 0.);
+  }
+
   // -- Check the admissibility of a solution.
   virtual bool IsAdmissible(Teuchos::RCP<const TreeVector> up) override { return true; }
 
@@ -109,6 +141,10 @@ class PK_BDF_Default : public PK_BDF {
   virtual void ChangedSolution() override = 0;
   virtual void ChangedSolution(const Tag& tag) = 0;
 
+ protected:
+  // wrap the time integrator's nonlinear solver in JFNK
+  void SetupJFNK_(Teuchos::ParameterList& bdf_plist);
+
  protected:                      // data
   bool assemble_preconditioner_; // preconditioner assembly control
   bool strongly_coupled_;        // if we are coupled, no need to make a TI
@@ -11,6 +11,7 @@
 #include "Mesh_Algorithms.hh"
 #include "Chemistry_PK.hh"
 #include "pk_helpers.hh"
+#include "column_geometry.hh"
 
 namespace Amanzi {
 
@@ -26,6 +27,25 @@ aliasVector(State& S, const Key& key, const Tag& target, const Tag& alias)
 }
 
 
+// -----------------------------------------------------------------------------
+// Require a secondary variable at tag target, and share its evaluator and data
+// with tag alias.
+// -----------------------------------------------------------------------------
+void
+requireAliasedEvaluator(State& S, const Key& key, const Tag& target, const Tag& alias)
+{
+  S.Require<CompositeVector, CompositeVectorSpace>(key, target);
+  S.RequireEvaluator(key, target);
+  if (!aliasVector(S, key, target, alias) &&
+      S.GetEvaluatorPtr(key, alias) != S.GetEvaluatorPtr(key, target)) {
+    Errors::Message msg;
+    msg << "Cannot share \"" << key << "\" at tag \"" << target.get() << "\" with tag \""
+        << alias.get() << "\": an evaluator already exists at the latter.";
+    Exceptions::amanzi_throw(msg);
+  }
+}
+
+
 // -----------------------------------------------------------------------------
 // Given a vector, apply the Dirichlet data to that vector.
 // -----------------------------------------------------------------------------
@@ -285,6 +305,71 @@ advanceChemistry(Teuchos::RCP<AmanziChemistry::Chemistry_PK> chem_pk,
 }
 
 
+namespace {
+
+// is val different from ref, relative to rtol?
+bool
+changed(double val, double ref, double rtol)
+{
+  return std::abs(val - ref) > rtol * std::max(std::abs(ref), 1.e-30);
+}
+
+} // namespace
+
+
+bool
+ChemistryChangeDetector::IsQuiescent(const Epetra_MultiVector& tcc,
+                                     const Epetra_MultiVector& temp,
+                                     const Epetra_MultiVector& wc,
+                                     double t)
+{
+  // owned cells only
+  int ncells = temp.MyLength();
+  int n_quiescent_l = 0;
+  if (tcc_ != Teuchos::null) {
+    for (int c = 0; c != ncells; ++c) {
+      bool cell_changed = changed(temp[0][c], (*temp_)[0][c], rtol_) ||
+                          changed(wc[0][c], (*wc_)[0][c], rtol_);
+      for (int k = 0; !cell_changed && k != tcc.NumVectors(); ++k) {
+        cell_changed = changed(tcc[k][c], (*tcc_)[k][c], rtol_);
+      }
+      if (!cell_changed) n_quiescent_l++;
+    }
+  }
+
+  int counts_l[2] = { n_quiescent_l, ncells };
+  int counts[2] = { 0, 0 };
+  temp.Comm().SumAll(counts_l, counts, 2);
+  n_quiescent_cells_ = counts[0];
+  n_cells_ = counts[1];
+
+  bool quiescent = tcc_ != Teuchos::null && n_quiescent_cells_ == n_cells_ &&
+                   t - t_solve_ <= max_interval_;
+  if (quiescent) n_skipped_++;
+  return quiescent;
+}
+
+
+void
+ChemistryChangeDetector::Record(const Epetra_MultiVector& tcc,
+                                const Epetra_MultiVector& temp,
+                                const Epetra_MultiVector& wc,
+                                double t)
+{
+  t_solve_ = t;
+  if (tcc_ == Teuchos::null) {
+    tcc_ = Teuchos::rcp(new Epetra_MultiVector(tcc));
+    temp_ = Teuchos::rcp(new Epetra_MultiVector(temp));
+    wc_ = Teuchos::rcp(new Epetra_MultiVector(wc));
+  } else {
+    *tcc_ = tcc;
+    *temp_ = temp;
+    *wc_ = wc;
+  }
+  n_solved_++;
+}
+
+
 void
 copyMeshCoordinatesToVector(const AmanziMesh::Mesh& mesh, CompositeVector& vec)
 {
@@ -315,6 +400,7 @@ copyVectorToMeshCoordinates(const CompositeVector& vec, AmanziMesh::Mesh& mesh)
     }
   }
   mesh.deform(node_ids, new_positions);
+  invalidateColumnGeometry(mesh);
 }
 
 int
@@ -10,6 +10,8 @@
 //! A set of helper functions for doing common things in PKs.
 #pragma once
 
+#include <algorithm>
+
 #include "Teuchos_TimeMonitor.hpp"
 
 #include "Mesh.hh"
@@ -25,6 +27,14 @@ namespace Amanzi {
 bool
 aliasVector(State& S, const Key& key, const Tag& target, const Tag& alias);
 
+// -----------------------------------------------------------------------------
+// Require a secondary variable at tag target, and share its evaluator and data
+// with tag alias.  The key is then evaluated once for both tags, and only when
+// its dependencies at target change.
+// -----------------------------------------------------------------------------
+void
+requireAliasedEvaluator(State& S, const Key& key, const Tag& target, const Tag& alias);
+
 // -----------------------------------------------------------------------------
 // Given a vector, apply the Dirichlet data to that vector's boundary_face
 // component.
@@ -124,6 +134,65 @@ advanceChemistry(Teuchos::RCP<AmanziChemistry::Chemistry_PK> chem_pk,
                  Teuchos::Time& timer);
 
 
+// Detects when no cell's chemistry inputs (total component concentration,
+// temperature, water content) have changed, relative to a tolerance, since
+// the last chemistry solve, so that the solve may be skipped and its previous
+// speciation reused.  Comparisons are against the last solve, not the last
+// step, so skipped steps cannot drift further than the tolerance.
+//
+// Skipping also skips reaction time, so a solve is forced once max_interval
+// has passed since the last one, and the caller should then integrate the
+// chemistry from SolveStartTime(), so that kinetic reactions catch up on
+// the skipped steps.
+class ChemistryChangeDetector {
+ public:
+  ChemistryChangeDetector(double rtol, double max_interval)
+    : rtol_(rtol), max_interval_(max_interval)
+  {}
+
+  // True if every owned cell on every rank is within tolerance, and the last
+  // solve was no more than max_interval before t.  Collective.
+  bool IsQuiescent(const Epetra_MultiVector& tcc,
+                   const Epetra_MultiVector& temp,
+                   const Epetra_MultiVector& wc,
+                   double t);
+
+  // Stores the inputs of a chemistry solve ending at time t, with tcc being
+  // its result.
+  void Record(const Epetra_MultiVector& tcc,
+              const Epetra_MultiVector& temp,
+              const Epetra_MultiVector& wc,
+              double t);
+
+  // Start time for a solve ending a step that starts at t_old: the end of the
+  // last solve, if steps were skipped since.
+  double SolveStartTime(double t_old) const
+  {
+    return tcc_ == Teuchos::null ? t_old : std::min(t_old, t_solve_);
+  }
+
+  // Called when the step starting at t_old fails.  Its retry then solves
+  // from t_old only, dropping the time skipped before it, so that a retry
+  // with a smaller step is also a shorter solve.
+  void FailStep(double t_old) { t_solve_ = t_old; }
+
+  // counters, global: cells within tolerance at the last check, and the
+  // number of solves skipped and done
+  int num_quiescent_cells() const { return n_quiescent_cells_; }
+  int num_cells() const { return n_cells_; }
+  int num_skipped() const { return n_skipped_; }
+  int num_solved() const { return n_solved_; }
+
+ private:
+  double rtol_;
+  double max_interval_;
+  double t_solve_ = 0.;
+  Teuchos::RCP<Epetra_MultiVector> tcc_, temp_, wc_;
+  int n_quiescent_cells_ = 0, n_cells_ = 0;
+  int n_skipped_ = 0, n_solved_ = 0;
+};
+
+
 void
 copyMeshCoordinatesToVector(const AmanziMesh::Mesh& mesh, CompositeVector& vec);
 void
@@ -87,6 +87,25 @@ PK_PhysicalBDF_Default::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
 double
 PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
                                   Teuchos::RCP<const TreeVector> res)
+{
+  ErrorNormAccumulator enorm;
+  ErrorNormLocal(u, res, enorm);
+  double enorm_val = enorm.Reduce(*mesh_->get_comm());
+
+  Teuchos::OSTab tab = vo_->getOSTab();
+  if (vo_->os_OK(Teuchos::VERB_MEDIUM)) enorm.Write(*vo_);
+  return enorm_val;
+};
+
+
+// -----------------------------------------------------------------------------
+// Rank-local contributions to the error norm, relative to the conserved
+// quantity.
+// -----------------------------------------------------------------------------
+void
+PK_PhysicalBDF_Default::ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                                       Teuchos::RCP<const TreeVector> res,
+                                       ErrorNormAccumulator& enorm)
 {
   // Abs tol based on old conserved quantity -- we know these have been vetted
   // at some level whereas the new quantity is some iterate, and may be
@@ -97,20 +116,9 @@ PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
   const Epetra_MultiVector& cv =
     *S_->Get<CompositeVector>(cell_vol_key_, tag_next_).ViewComponent("cell", true);
 
-  // VerboseObject stuff.
-  Teuchos::OSTab tab = vo_->getOSTab();
-  if (vo_->os_OK(Teuchos::VERB_MEDIUM))
-    *vo_->os() << "ENorm (Infnorm) of: " << conserved_key_ << ": " << std::endl;
-
   Teuchos::RCP<const CompositeVector> dvec = res->Data();
   double h = S_->get_time(tag_next_) - S_->get_time(tag_current_);
 
-  Teuchos::RCP<const Comm_type> comm_p = mesh_->get_comm();
-  Teuchos::RCP<const MpiComm_type> mpi_comm_p =
-    Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_p);
-  const MPI_Comm& comm = mpi_comm_p->Comm();
-
-  double enorm_val = 0.0;
   for (CompositeVector::name_iterator comp = dvec->begin(); comp != dvec->end(); ++comp) {
     double enorm_comp = 0.0;
     int enorm_loc = -1;
@@ -133,15 +141,14 @@ PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
     } else if (*comp == std::string("face")) {
       // error in flux -- relative to cell's extensive conserved quantity
       int nfaces = dvec->size(*comp, false);
+      const auto& face_cells = FaceCells_();
 
       for (unsigned int f = 0; f != nfaces; ++f) {
-        AmanziMesh::Entity_ID_List cells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::OWNED, &cells);
-        double cv_min =
-          cells.size() == 1 ? cv[0][cells[0]] : std::min(cv[0][cells[0]], cv[0][cells[1]]);
-        double conserved_min = cells.size() == 1 ?
-                                 conserved[0][cells[0]] :
-                                 std::min(conserved[0][cells[0]], conserved[0][cells[1]]);
+        AmanziMesh::Entity_ID c0 = face_cells[2 * f];
+        AmanziMesh::Entity_ID c1 = face_cells[2 * f + 1];
+        double cv_min = c1 < 0 ? cv[0][c0] : std::min(cv[0][c0], cv[0][c1]);
+        double conserved_min =
+          c1 < 0 ? conserved[0][c0] : std::min(conserved[0][c0], conserved[0][c1]);
 
         double enorm_f = fluxtol_ * h * std::abs(dvec_v[0][f]) /
                          (atol_ * cv_min + rtol_ * std::abs(conserved_min));
@@ -158,34 +165,49 @@ PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
       //      AMANZI_ASSERT(norm < 1.e-15);
     }
 
-    // Write out Inf norms too.
-    if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
-      double infnorm(0.);
-      dvec_v.NormInf(&infnorm);
-
-      ENorm_t err;
-      ENorm_t l_err;
-      l_err.value = enorm_comp;
-      l_err.gid = dvec_v.Map().GID(enorm_loc);
+    enorm.Add(conserved_key_,
+              *comp,
+              enorm_comp,
+              dvec_v.Map().GID(enorm_loc),
+              LocalInfNorm_(dvec_v));
+  }
+};
 
-      int ierr;
 
-      ierr = MPI_Allreduce(&l_err, &err, 1, MPI_DOUBLE_INT, MPI_MAXLOC, comm);
-      AMANZI_ASSERT(!ierr);
-      *vo_->os() << "  ENorm (" << *comp << ") = " << err.value << "[" << err.gid << "] ("
-                 << infnorm << ")" << std::endl;
+// -----------------------------------------------------------------------------
+// Face-to-cell adjacency of owned faces, used in error norms.  The second
+// cell is -1 for faces with only one owned cell.  This is topological, so
+// is valid for the life of the mesh.
+// -----------------------------------------------------------------------------
+const std::vector<AmanziMesh::Entity_ID>&
+PK_PhysicalBDF_Default::FaceCells_()
+{
+  int nfaces = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
+  if (face_cells_.size() != 2 * nfaces) {
+    face_cells_.resize(2 * nfaces, -1);
+    AmanziMesh::Entity_ID_List cells;
+    for (int f = 0; f != nfaces; ++f) {
+      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::OWNED, &cells);
+      face_cells_[2 * f] = cells[0];
+      face_cells_[2 * f + 1] = cells.size() > 1 ? cells[1] : -1;
     }
-
-    enorm_val = std::max(enorm_val, enorm_comp);
   }
+  return face_cells_;
+}
 
-  double enorm_val_l = enorm_val;
 
-  int ierr;
-  ierr = MPI_Allreduce(&enorm_val_l, &enorm_val, 1, MPI_DOUBLE, MPI_MAX, comm);
-  AMANZI_ASSERT(!ierr);
-  return enorm_val;
-};
+// -----------------------------------------------------------------------------
+// Inf norm of the local part of a vector, with no communication.
+// -----------------------------------------------------------------------------
+double
+PK_PhysicalBDF_Default::LocalInfNorm_(const Epetra_MultiVector& vec)
+{
+  double infnorm = 0.;
+  for (int k = 0; k != vec.NumVectors(); ++k) {
+    for (int i = 0; i != vec.MyLength(); ++i) infnorm = std::max(infnorm, std::abs(vec[k][i]));
+  }
+  return infnorm;
+}
 
 
 void
@@ -93,6 +93,9 @@ class PK_PhysicalBDF_Default : public PK_BDF_Default, public PK_Physical_Default
   // -- Compute a norm on u-du and return the result.
   virtual double
   ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> du) override;
+  virtual void ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                              Teuchos::RCP<const TreeVector> du,
+                              ErrorNormAccumulator& enorm) override;
 
   virtual bool ValidStep() override
   {
@@ -117,6 +120,11 @@ class PK_PhysicalBDF_Default : public PK_BDF_Default, public PK_Physical_Default
   std::vector<double>& bc_values() { return bc_->bc_value(); }
   Teuchos::RCP<Operators::BCs> BCs() { return bc_; }
 
+ protected:
+  // cached face-to-cell adjacency for error norms
+  const std::vector<AmanziMesh::Entity_ID>& FaceCells_();
+  static double LocalInfNorm_(const Epetra_MultiVector& vec);
+
  protected:
   // PC
   Teuchos::RCP<Operators::Operator> preconditioner_;
@@ -128,6 +136,7 @@ class PK_PhysicalBDF_Default : public PK_BDF_Default, public PK_Physical_Default
   Key conserved_key_;
   Key cell_vol_key_;
   double atol_, rtol_, fluxtol_;
+  std::vector<AmanziMesh::Entity_ID> face_cells_;
 };
 
 
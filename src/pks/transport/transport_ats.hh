@@ -83,6 +83,8 @@ The advection-diffusion equation for component *i* in the surface may be written
       default to the same as the `"diffusion`" list.  See PDE_Diffusion_.
 
     * `"inverse`" ``[inverse-typed-spec]`` Inverse_ method for the solve.
+      The `"iterative method`" may also be `"pipelined pcg`", see
+      `iterative-method-pipelined-spec`_.
 
     * `"cfl`" [double] Time step limiter, a number less than 1. Default value is 1.
 
@@ -34,6 +34,7 @@
 #include "PDE_Accumulation.hh"
 #include "PK_DomainFunctionFactory.hh"
 #include "PK_Utils.hh"
+#include "pipelined_krylov.hh"
 #include "pk_helpers.hh"
 
 #include "TransportDomainFunction.hh"
@@ -1063,7 +1064,13 @@ Transport_ATS ::Advance_Dispersion_Diffusion(double t_old, double t_new)
 
     // diffusion operator
     Teuchos::ParameterList& op_list = plist_->sublist("diffusion");
-    op_list.set("inverse", plist_->sublist("inverse"));
+    const Teuchos::ParameterList& inv_list = plist_->sublist("inverse");
+    bool pipelined = Operators::isPipelinedKrylov(inv_list);
+    if (pipelined) {
+      op_list.set("inverse", Operators::preconditionerOnly(inv_list));
+    } else {
+      op_list.set("inverse", inv_list);
+    }
 
     Operators::PDE_DiffusionFactory opfactory;
     Teuchos::RCP<Operators::PDE_Diffusion> op1 = opfactory.Create(op_list, mesh_, bc_dummy);
@@ -1083,6 +1090,26 @@ Transport_ATS ::Advance_Dispersion_Diffusion(double t_old, double t_new)
     bool flag_op1(true);
     double md_change, md_old(0.0), md_new, residual(0.0);
 
+    // solve, either with the operator's inverse or with a pipelined Krylov
+    // method preconditioned by it
+    std::string solver_msg;
+    auto solve = [&](const CompositeVector& rhs) {
+      int ierr;
+      if (pipelined) {
+        Operators::PipelinedKrylov<Operators::Operator, CompositeVector> solver(inv_list, op);
+        ierr = solver.ApplyInverse(rhs, sol);
+        residual += solver.residual();
+        num_itrs += solver.num_itrs();
+        solver_msg = solver.returned_code_string();
+      } else {
+        ierr = op->ApplyInverse(rhs, sol);
+        residual += op->residual();
+        num_itrs += op->num_itrs();
+        solver_msg = op->returned_code_string();
+      }
+      return ierr;
+    };
+
     // Disperse and diffuse aqueous components
     for (int i = 0; i < num_aqueous; i++) {
       FindDiffusionValue(component_names_[i], &md_new, &phase);
@@ -1123,17 +1150,14 @@ Transport_ATS ::Advance_Dispersion_Diffusion(double t_old, double t_new)
       }
 
       CompositeVector& rhs = *op->rhs();
-      int ierr = op->ApplyInverse(rhs, sol);
+      int ierr = solve(rhs);
 
       if (ierr < 0) {
         Errors::Message msg("TransportExplicit_PK solver failed with message: \"");
-        msg << op->returned_code_string() << "\"";
+        msg << solver_msg << "\"";
         Exceptions::amanzi_throw(msg);
       }
 
-      residual += op->residual();
-      num_itrs += op->num_itrs();
-
       for (int c = 0; c < ncells_owned; c++) { tcc_next[i][c] = sol_cell[0][c]; }
       if (sol.HasComponent("face")) {
         if (tcc_tmp->HasComponent("boundary_face")) {
@@ -1193,16 +1217,13 @@ Transport_ATS ::Advance_Dispersion_Diffusion(double t_old, double t_new)
       op2->AddAccumulationDelta(sol, factor0, factor, dt_MPC, "cell");
 
       CompositeVector& rhs = *op->rhs();
-      int ierr = op->ApplyInverse(rhs, sol);
+      int ierr = solve(rhs);
       if (ierr < 0) {
         Errors::Message msg("Transport_PK solver failed with message: \"");
-        msg << op->returned_code_string() << "\"";
+        msg << solver_msg << "\"";
         Exceptions::amanzi_throw(msg);
       }
 
-      residual += op->residual();
-      num_itrs += op->num_itrs();
-
       for (int c = 0; c < ncells_owned; c++) { tcc_next[i][c] = sol_cell[0][c]; }
     }
 
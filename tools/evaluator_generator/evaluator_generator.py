@@ -1,9 +1,12 @@
-import sys,os
+import sys,os,re
+import sympy
 from sympy.printing import ccode
 
 _template_directory = os.path.dirname(os.path.abspath(__file__))
 _templates = {}
 
+_line_width = 100
+
 def loadTemplate(tname):
     with open(os.path.join(_template_directory, "templates", tname),'r') as tfid:
         _templates[tname] = tfid.read()[:-1] # python seems to force end of file with newline character even though it is not there?
@@ -13,14 +16,105 @@ def render(tname, d):
         template = _templates[tname]
     except KeyError:
         loadTemplate(tname)
-        template = _templates[tname]        
+        template = _templates[tname]
 
-    assert type(d) is dict        
+    assert type(d) is dict
     return template.format(**d)
-    
+
+
+def formatArgs(prefix, args, suffix, width=_line_width):
+    """Formats prefix(args)suffix the way clang-format does with bin packing off.
+
+    prefix includes the opening parenthesis and suffix the closing one.  The
+    arguments go on one line if they fit, else one per line aligned after the
+    parenthesis, else one per line on their own indented lines.
+    """
+    line = prefix + ", ".join(args) + suffix
+    if len(line) <= width:
+        return line
+
+    pad = " " * len(prefix)
+    if len(pad) + max(len(arg) for arg in args) + len(suffix) + 1 <= width:
+        return prefix + (",\n"+pad).join(args) + suffix
+
+    pad = " " * (len(prefix) - len(prefix.lstrip()) + 2)
+    return prefix + "\n" + pad + (",\n"+pad).join(args) + suffix
+
+
+def formatList(prefix, items, suffix, indent, width=_line_width):
+    """Formats a braced initializer list, filling lines if it does not fit on one."""
+    line = prefix + "{ " + ", ".join(items) + " }" + suffix
+    if len(line) <= width:
+        return line
+
+    lines = []
+    current = indent + "  "
+    for item in items:
+        if current.strip() and len(current) + len(item) + 2 > width:
+            lines.append(current.rstrip())
+            current = indent + "  "
+        current += item + ", "
+    lines.append(current[:-2])
+    return prefix + "{\n" + "\n".join(lines) + "\n" + indent + "}" + suffix
+
+
+def formatExpression(expr):
+    """C code for a sympy expression, with spaces around binary * and /."""
+    return re.sub(r"(?<=\S)\s*([*/])\s*(?=\S)", r" \1 ", ccode(expr))
+
+
+def wrapExpression(prefix, code, suffix, width=_line_width):
+    """Breaks prefix+code+suffix after + and - operators to fit in width.
+
+    Continuation lines are aligned after the innermost open parenthesis, and
+    once a parenthesized group is broken, the operators after it at a lower
+    nesting level are broken as well, as clang-format does.
+    """
+    if len(prefix) + len(code) + len(suffix) <= width:
+        return prefix + code + suffix
+
+    lines = []
+    current = prefix
+    parens = []   # columns just after each open parenthesis
+    breaks = []   # (column to break at, indentation of the continuation)
+    broken_depth = None
+
+    def breakAt(pos, indent):
+        nonlocal current, parens, breaks
+        lines.append(current[:pos].rstrip())
+        shift = indent - pos
+        current = " " * indent + current[pos:]
+        parens = [p + shift if p > pos else p for p in parens]
+        breaks = [(b + shift, i, d) for (b, i, d) in breaks if b > pos]
+
+    for ch in code + suffix:
+        current += ch
+        if ch == '(':
+            parens.append(len(current))
+        elif ch == ')':
+            parens.pop()
+        elif current.endswith(" + ") or current.endswith(" - "):
+            depth = len(parens)
+            indent = parens[-1] if parens else len(prefix)
+            if broken_depth is not None and depth < broken_depth:
+                breakAt(len(current), indent)
+                broken_depth = depth
+                continue
+            breaks.append((len(current), indent, depth))
+
+        if len(current) > width:
+            fits = [b for b in breaks if b[0] <= width]
+            if fits:
+                pos, indent, depth = fits[-1]
+                breakAt(pos, indent)
+                broken_depth = depth if broken_depth is None else min(depth, broken_depth)
+    lines.append(current)
+    return "\n".join(lines)
+
+
 class EvalGen(object):
     def __init__(self, name, namespace, descriptor, my_key=None, expression=None,
-                 doc=None, **kwargs):
+                 doc=None, simd=False, **kwargs):
         self.d = {}
         self.setName(name, **kwargs)
         self.setNamespace(namespace, **kwargs)
@@ -36,6 +130,7 @@ class EvalGen(object):
         self.par_names = []
         self.par_defaults = []
         self.expression = expression
+        self.simd = simd
         if doc is not None:
             self.d['docDict'] = doc
         else:
@@ -72,6 +167,18 @@ class EvalGen(object):
         self.par_names.append(parname)
         self.par_defaults.append(default)
 
+    def evaluatorName(self):
+        return self.d['evalClassName']+"Evaluator"
+
+    def modelName(self):
+        return self.d['evalClassName']+"Model"
+
+    def declarationArgs(self):
+        return ["double %s"%var for var in self.vars]
+
+    def derivPointerDeclarationArgs(self):
+        return ["double* d_%s"%var for var in self.vars]
+
     def renderCopyConstructor(self):
         return '\n'.join([render('evaluator_keyCopyConstructor.cc', dict(arg=arg,var=var)) for arg,var in zip(self.args,self.vars)])
 
@@ -81,75 +188,127 @@ class EvalGen(object):
     def renderKeyInitialize(self):
         dicts = []
         for arg,var in zip(self.args, self.vars):
-            dicts.append(dict(arg=arg, argString=arg.replace("_", " "), var=var))
+            readKey = formatArgs("  %s_key_ = Keys::readKey("%var,
+                                 ["plist_", "domain_name", '"%s"'%arg.replace("_", " "), '"%s"'%arg], ");")
+            dicts.append(dict(arg=arg, var=var, readKey=readKey))
         return '\n\n'.join([render('evaluator_keyInitialize.cc', argdict) for argdict in dicts])
 
     def renderKeyCompositeVector(self):
-        return '\n'.join([render('evaluator_keyCompositeVector.cc', dict(arg=arg,var=var)) for arg,var in zip(self.args,self.vars)])        
+        return '\n'.join([render('evaluator_keyCompositeVector.cc',
+                                 dict(getPtr=formatArgs("  Teuchos::RCP<const CompositeVector> %s = S.GetPtr<CompositeVector>("%var,
+                                                        ["%s_key_"%var, "tag"], ");")))
+                          for var in self.vars])
 
-    def renderKeyEpetraVector(self):
-        return '\n'.join([render('evaluator_keyEpetraVector.cc', dict(arg=arg,var=var)) for arg,var in zip(self.args,self.vars)])        
-    def renderKeyEpetraVectorIndented(self):
-        return '\n'.join([render('evaluator_keyEpetraVectorIndented.cc', dict(arg=arg,var=var)) for arg,var in zip(self.args,self.vars)])        
+    def renderKeyEpetraVector(self, indent):
+        return '\n'.join([render('evaluator_keyEpetraVector.cc',
+                                 dict(viewComponent="%sconst Epetra_MultiVector& %s_v = *%s->ViewComponent(*comp, false);"%(indent,var,var)))
+                          for var in self.vars])
 
     def renderMyMethodArgs(self):
-        return ", ".join(["%s_v[0][i]"%var for var in self.vars])
-
-    def renderMyMethodDeclarationArgs(self):
-        return ", ".join(["double %s"%var for var in self.vars])
+        return ["%s_v[0][i]"%var for var in self.vars]
+
+    def renderEvaluatorSignatures(self):
+        ev = self.evaluatorName()
+        self.d['copyConstructorDeclaration'] = formatArgs("  %s("%ev, ["const %s& other"%ev], ");")
+        self.d['copyConstructorSignature'] = formatArgs("%s::%s("%(ev,ev), ["const %s& other"%ev], ")")
+        self.d['evaluateSignature'] = formatArgs("%s::Evaluate_("%ev,
+                                                 ["const State& S", "const std::vector<CompositeVector*>& result"], ")")
+        self.d['evaluatePartialSignature'] = formatArgs("%s::EvaluatePartialDerivative_("%ev,
+                                                        ["const State& S", "const Key& wrt_key", "const Tag& wrt_tag",
+                                                         "const std::vector<CompositeVector*>& result"], ")")
 
     def renderEvaluateModel(self):
         d = dict()
-        d['keyEpetraVectorList'] = self.renderKeyEpetraVector()
-        d['myKeyMethod'] = self.d['myKeyMethod']
-        d['myMethodArgs'] = self.renderMyMethodArgs()
+        if self.simd:
+            d['keyEpetraVectorList'] = self.renderKeyEpetraVector("    ")
+            d['modelCall'] = formatArgs("    model_->%s("%self.d['myKeyMethod'],
+                                        ["ncomp"] + ["%s_v[0]"%var for var in self.vars] + ["result_v[0]"], ");")
+            return render('evaluator_evaluateModelSimd.cc', d)
+
+        d['keyEpetraVectorList'] = self.renderKeyEpetraVector("    ")
+        d['modelCall'] = formatArgs("      result_v[0][i] = model_->%s("%self.d['myKeyMethod'],
+                                    self.renderMyMethodArgs(), ");")
         return render('evaluator_evaluateModel.cc', d)
 
     def renderEvaluateDerivs(self):
-        wrt_list = []
-
-        def getDict(arg,var):
-            d = dict(arg=arg,var=var)
-            d['keyEpetraVectorList'] = self.renderKeyEpetraVectorIndented()
-            d['myKeyMethod'] = self.d['myKeyMethod']
-            d['wrtMethod'] = ''.join([word[0].upper()+word[1:] for word in arg.split("_")])
-            d['myMethodArgs'] = self.renderMyMethodArgs()
-            return d
-        
-        if len(self.args) > 0:
-            d = getDict(self.args[0], self.vars[0])
-            d['if_elseif'] = render('evaluator_ifWRT.cc', d)
-            wrt_list.append(render('evaluator_evaluateDerivs.cc', d))
-
-        if len(self.args) > 1:
-            for arg,var in zip(self.args[1:],self.vars[1:]):
-                d = getDict(arg,var)
-                d['if_elseif'] = render('evaluator_elseifWRT.cc', d)
-                wrt_list.append(render('evaluator_evaluateDerivs.cc', d))
-
-        wrt_list.append('\n'.join(["  } else {",
-                                   "    ASSERT(0);",
-                                   "  }"]))
-
-        return "\n\n".join(wrt_list)
-                            
+        """Requested partials in one pass through the fused model method, cached.
+
+        The DAG requests one partial at a time, so the first request after the
+        value is updated fills partials_ and later ones copy out of it.  Only
+        partials that have been requested are allocated and computed.
+        """
+        d = dict()
+        d['keyEpetraVectorList'] = self.renderKeyEpetraVector("      ")
+        d['nDeps'] = len(self.vars)
+        d['wrtKeyList'] = formatList("", ["&%s_key_"%var for var in self.vars], "", "  ")
+        d['modelCall'] = formatArgs("        model_->%sAndDerivatives("%self.d['myKeyMethod'],
+                                    self.renderMyMethodArgs() + ["d[%i]"%i for i in range(len(self.vars))], ");")
+        return render('evaluator_evaluateFusedDerivs.cc', d)
+
     def renderModelMethodDeclaration(self):
-        return render('model_declaration.hh', dict(myMethod=self.d['myKeyMethod'],
-                                                   myMethodDeclarationArgs=self.d['myMethodDeclarationArgs']))
+        return render('model_declaration.hh',
+                      dict(declaration=formatArgs("  double %s("%self.d['myKeyMethod'], self.declarationArgs(), ") const;")))
+
+    def derivMethodName(self, arg):
+        return "D%sD%s"%(self.d['myKeyMethod'],''.join([word[0].upper()+word[1:] for word in arg.split("_")]))
 
     def renderModelDerivDeclarations(self):
         return '\n'.join([render('model_declaration.hh',
-                                 dict(myMethod="D%sD%s"%(self.d['myKeyMethod'],''.join([word[0].upper()+word[1:] for word in arg.split("_")])),
-                                      myMethodDeclarationArgs=self.d['myMethodDeclarationArgs'])) for arg in self.args])
+                                 dict(declaration=formatArgs("  double %s("%self.derivMethodName(arg), self.declarationArgs(), ") const;")))
+                          for arg in self.args])
+
+    def renderModelFusedDeclaration(self):
+        return render('model_fusedDeclaration.hh',
+                      dict(declaration=formatArgs("  double %sAndDerivatives("%self.d['myKeyMethod'],
+                                                  self.declarationArgs() + self.derivPointerDeclarationArgs(), ") const;")))
+
+    def renderModelFusedImplementation(self):
+        """Value and all partials, sharing common subexpressions.
+
+        Each partial is only stored if its pointer is non-null.
+        """
+        lines = []
+        if self.expression is not None:
+            exprs = [self.expression] + [self.expression.diff(var) for var in self.vars]
+            replacements, reduced = sympy.cse(exprs, symbols=sympy.numbered_symbols("x"))
+            for sym, sub in replacements:
+                lines.append(wrapExpression("  double %s = "%ccode(sym), formatExpression(sub), ";"))
+            for var, deriv in zip(self.vars, reduced[1:]):
+                lines.append(wrapExpression("  if (d_%s) *d_%s = "%(var, var), formatExpression(deriv), ";"))
+            lines.append(wrapExpression("  return ", formatExpression(reduced[0]), ";"))
+        else:
+            lines.append("  AMANZI_ASSERT(false);")
+            lines.append("  return 0.;")
+        signature = formatArgs("%s::%sAndDerivatives("%(self.modelName(), self.d['myKeyMethod']),
+                               self.declarationArgs() + self.derivPointerDeclarationArgs(), ") const")
+        return render('model_fusedImplementation.cc', dict(signature=signature,
+                                                           myMethodImplementation='\n'.join(lines)))
+
+    def renderModelSimdImplementation(self):
+        """Inline array kernel over a contiguous block of cells.
+
+        Emitted into the model header so that it can be inlined into the
+        evaluator loop and vectorized.
+        """
+        if not self.simd:
+            return ""
+        assert self.expression is not None, "simd kernels require an expression"
+        indexed = dict((sym, sympy.Symbol("%s[i]"%sym.name)) for sym in self.expression.free_symbols
+                       if sym.name in self.vars)
+        implementation = wrapExpression("      result[i] = ", formatExpression(self.expression.xreplace(indexed)), ";")
+        declaration = formatArgs("  void %s("%self.d['myKeyMethod'],
+                                 ["int n"] + ["const double* __restrict__ %s"%var for var in self.vars]
+                                 + ["double* __restrict__ result"], ") const")
+        return render('model_simdImplementation.hh',
+                      dict(declaration=declaration, myMethodImplementation=implementation)) + "\n"
 
     def renderModelMethodImplementation(self):
         if self.expression is not None:
-            implementation = ccode(self.expression)
+            implementation = wrapExpression("  return ", formatExpression(self.expression), ";")
         else:
-            implementation = "ASSERT(False)"
-        return render('model_methodImplementation.cc', dict(evalClassName=self.d['evalClassName'],
-                                                            myMethod=self.d['myKeyMethod'],
-                                                            myMethodDeclarationArgs=self.d['myMethodDeclarationArgs'],
+            implementation = "  AMANZI_ASSERT(false);\n  return 0.;"
+        signature = formatArgs("%s::%s("%(self.modelName(), self.d['myKeyMethod']), self.declarationArgs(), ") const")
+        return render('model_methodImplementation.cc', dict(signature=signature,
                                                             myMethodImplementation=implementation))
 
     def renderModelDerivImplementations(self):
@@ -157,19 +316,16 @@ class EvalGen(object):
 
         for arg,var in zip(self.args,self.vars):
             if self.expression is not None:
-                print("differentiation of", self.expression, "with respect to", var)
-                implementation = ccode(self.expression.diff(var))
+                implementation = wrapExpression("  return ", formatExpression(self.expression.diff(var)), ";")
             else:
-                implementation = "ASSERT(False)"
+                implementation = "  AMANZI_ASSERT(false);\n  return 0.;"
+            signature = formatArgs("%s::%s("%(self.modelName(), self.derivMethodName(arg)), self.declarationArgs(), ") const")
             impls.append(render('model_methodImplementation.cc',
-                                dict(evalClassName=self.d['evalClassName'],
-                                     myMethod="D%sD%s"%(self.d['myKeyMethod'],''.join([word[0].upper()+word[1:] for word in arg.split("_")])),
-                                     myMethodDeclarationArgs=self.d['myMethodDeclarationArgs'],
-                                     myMethodImplementation=implementation)))
+                                dict(signature=signature, myMethodImplementation=implementation)))
         return '\n\n'.join(impls)
-    
+
     def renderModelParamDeclarations(self):
-        return '\n'.join(['  %s %s;'%p for p in self.pars])
+        return ''.join(['  %s %s;\n'%p for p in self.pars])
 
     def renderModelParamInitializations(self):
         p_inits = []
@@ -179,26 +335,29 @@ class EvalGen(object):
             else:
                 p_inits.append('  %s = plist.get<%s>("%s");'%(p[1],p[0],pname))
 
-        return '\n'.join(p_inits)
+        if len(p_inits) == 0:
+            return ''
+        return '\n' + '\n'.join(p_inits) + '\n'
 
     def genArgs(self):
         # dependencies
         self.d['keyDeclarationList'] = self.renderKeyDeclaration()
         self.d['keyCopyConstructorList'] = self.renderCopyConstructor()
-        print(self.d['keyCopyConstructorList'])
         self.d['keyInitializeList'] = self.renderKeyInitialize()
         self.d['keyCompositeVectorList'] = self.renderKeyCompositeVector()
-        self.d['myMethodArgs'] = self.renderMyMethodArgs()
-        self.d['myMethodDeclarationArgs'] = self.renderMyMethodDeclarationArgs()
+        self.renderEvaluatorSignatures()
         self.d['evaluateModel'] = self.renderEvaluateModel()
         self.d['evaluateDerivs'] = self.renderEvaluateDerivs()
 
         self.d['modelMethodDeclaration'] = self.renderModelMethodDeclaration()
         self.d['modelDerivDeclarationList'] = self.renderModelDerivDeclarations()
+        self.d['modelFusedDeclaration'] = self.renderModelFusedDeclaration()
+        self.d['modelSimdImplementation'] = self.renderModelSimdImplementation()
         self.d['paramDeclarationList'] = self.renderModelParamDeclarations()
 
         self.d['modelMethodImplementation'] = self.renderModelMethodImplementation()
         self.d['modelDerivImplementationList'] = self.renderModelDerivImplementations()
+        self.d['modelFusedImplementation'] = self.renderModelFusedImplementation()
         self.d['modelInitializeParamsList'] = self.renderModelParamInitializations()
 
 def generate_evaluator(name, namespace, descriptor, my_key, dependencies, parameters, **kwargs):
@@ -231,6 +390,9 @@ def generate_evaluator(name, namespace, descriptor, my_key, dependencies, parame
 
       directory: directory where output files are created
 
+      simd: if True, also emit an inline array kernel in the model header,
+            and evaluate the value through it over whole component blocks
+
     Outputs:
       writes files: [name]_evaluator.hh
                     [name]_evaluator.cc
@@ -258,11 +420,11 @@ def generate_evaluator(name, namespace, descriptor, my_key, dependencies, parame
     files = ["evaluator.hh", "evaluator.cc", "evaluator_reg.hh", "model.hh", "model.cc"]
     for outfile in files:
         with open(os.path.join(directory, "%s_%s"%(name,outfile)), 'w') as fid:
-            fid.write(render(outfile, eg.d))
+            fid.write(render(outfile, eg.d) + "\n")
+
+
 
 
-      
-        
 if __name__ == "__main__":
     eg = EvalGen("iem", "energy", "internal energy", "internal_energy", evalClassName='IEM')
     eg.addArg("temperature", "temp");
@@ -273,4 +435,4 @@ if __name__ == "__main__":
     print (render("evaluator.cc", eg.d))
     print (render("evaluator_reg.hh", eg.d))
     print (render("model.hh", eg.d))
-    print (render("model.cc", eg.d))    
+    print (render("model.cc", eg.d))
@@ -15,63 +15,51 @@
 
 */
 
-#ifndef AMANZI_{ namespaceCaps } _{ evalNameCaps } _EVALUATOR_HH_
-#define AMANZI_ { namespaceCaps } _{ evalNameCaps } _EVALUATOR_HH_
+#pragma once
 
 #include "Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
 
-namespace Amanzi {
-{
-  namespace {namespace}
-  {
-    {
-      namespace Relations {
-      {
-        class {
-          evalClassName
-        } Model;
-
-        class {
-          evalClassName
-        } Evaluator : public EvaluatorSecondaryMonotypeCV{ {
-
-          public : explicit { evalClassName } Evaluator(Teuchos::ParameterList & plist);
-        { evalClassName } Evaluator(const { evalClassName } Evaluator & other);
-
-        virtual Teuchos::RCP<Evaluator> Clone() const;
-
-        // Required methods from EvaluatorSecondaryMonotypeCV
-        virtual void EvaluateField_(const Teuchos::Ptr<State>& S,
-                                    const Teuchos::Ptr<CompositeVector>& result);
-        virtual void EvaluateFieldPartialDerivative_(
-          const Teuchos::Ptr<State>& S, Key wrt_key, const Teuchos::Ptr<CompositeVector>& result);
-
-        Teuchos::RCP<{ evalClassName } Model> get_model()
-        {
-          {
-            return model_;
-          }
-        }
-
-       protected:
-        void InitializeFromPlist_();
-
-        { keyDeclarationList }
-
-        Teuchos::RCP<{ evalClassName } Model>
-          model_;
-
-       private:
-        static Utils::RegisteredFactory<Evaluator, { evalClassName } Evaluator> reg_;
-
-      }  // namespace Relations
-      }; // namespace Relations
-    }
-  } // namespace }
-} // namespace Amanzi
-} // namespace Amanzi
-}
-} //namespace
-
-#endif
+namespace Amanzi {{
+namespace {namespace} {{
+namespace Relations {{
+
+class {evalClassName}Model;
+
+class {evalClassName}Evaluator : public EvaluatorSecondaryMonotypeCV {{
+ public:
+  explicit {evalClassName}Evaluator(Teuchos::ParameterList& plist);
+{copyConstructorDeclaration}
+
+  virtual Teuchos::RCP<Evaluator> Clone() const override;
+
+  Teuchos::RCP<{evalClassName}Model> get_model() {{ return model_; }}
+
+ protected:
+  // Required methods from EvaluatorSecondaryMonotypeCV
+  virtual void Evaluate_(const State& S, const std::vector<CompositeVector*>& result) override;
+  virtual void EvaluatePartialDerivative_(const State& S,
+                                          const Key& wrt_key,
+                                          const Tag& wrt_tag,
+                                          const std::vector<CompositeVector*>& result) override;
+
+  void InitializeFromPlist_();
+
+ protected:
+{keyDeclarationList}
+
+  Teuchos::RCP<{evalClassName}Model> model_;
+
+  // partial derivatives with respect to each dependency, in the order above,
+  // null until first requested, and recomputed together on the first
+  // request after the value is updated
+  std::vector<Teuchos::RCP<CompositeVector>> partials_;
+  bool partials_valid_;
+
+ private:
+  static Utils::RegisteredFactory<Evaluator, {evalClassName}Evaluator> reg_;
+}};
+
+}} // namespace Relations
+}} // namespace {namespace}
+}} // namespace Amanzi
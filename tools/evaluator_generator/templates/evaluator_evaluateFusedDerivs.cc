@@ -0,0 +1,36 @@
+  const std::array<const Key*, {nDeps}> wrt_keys = {wrtKeyList};
+  std::size_t k = 0;
+  while (k != wrt_keys.size() && *wrt_keys[k] != wrt_key) ++k;
+  AMANZI_ASSERT(k != wrt_keys.size());
+
+  // The DAG requests one partial at a time, but they share subexpressions, so
+  // every partial requested so far is computed in a single pass on the first
+  // request after Evaluate_() and then served from partials_.  Partials that
+  // are never requested are neither allocated nor computed.
+  if (partials_.size() != wrt_keys.size()) partials_.resize(wrt_keys.size());
+  if (partials_[k] == Teuchos::null) {{
+    partials_[k] = Teuchos::rcp(new CompositeVector(result[0]->Map()));
+    partials_valid_ = false;
+  }}
+
+  if (!partials_valid_) {{
+    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
+         ++comp) {{
+{keyEpetraVectorList}
+      std::array<Epetra_MultiVector*, {nDeps}> d_v;
+      for (std::size_t j = 0; j != d_v.size(); ++j) {{
+        d_v[j] =
+          partials_[j] == Teuchos::null ? nullptr : partials_[j]->ViewComponent(*comp, false).get();
+      }}
+      std::array<double*, {nDeps}> d;
+
+      int ncomp = result[0]->size(*comp, false);
+      for (int i = 0; i != ncomp; ++i) {{
+        for (std::size_t j = 0; j != d.size(); ++j) d[j] = d_v[j] ? &(*d_v[j])[0][i] : nullptr;
+{modelCall}
+      }}
+    }}
+    partials_valid_ = true;
+  }}
+
+  *result[0] = *partials_[k];
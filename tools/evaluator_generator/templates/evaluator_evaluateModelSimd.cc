@@ -0,0 +1,7 @@
+  for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end(); ++comp) {{
+{keyEpetraVectorList}
+    Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
+
+    int ncomp = result[0]->size(*comp, false);
+{modelCall}
+  }}
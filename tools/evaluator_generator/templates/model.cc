@@ -19,37 +19,31 @@
 #include "dbc.hh"
 #include "{evalName}_model.hh"
 
-namespace Amanzi {
-{
-  namespace {namespace}
-  {
-    {
-      namespace Relations {
-      {
-        // Constructor from ParameterList
-        { evalClassName } Model::{ evalClassName } Model(Teuchos::ParameterList & plist)
-        {
-          {
-            InitializeFromPlist_(plist);
-          }
-        }
-
-
-        // Initialize parameters
-        void{ evalClassName } Model::InitializeFromPlist_(
-          Teuchos::ParameterList & plist){ { { modelInitializeParamsList } } }
-
-
-        // main method
-        { modelMethodImplementation }
-
-        {
-          modelDerivImplementationList
-        }
-
-      } // namespace Relations
-      } // namespace Relations
-    }
-  } // namespace }
-} // namespace Amanzi
-} // namespace Amanzi
+namespace Amanzi {{
+namespace {namespace} {{
+namespace Relations {{
+
+// Constructor from ParameterList
+{evalClassName}Model::{evalClassName}Model(Teuchos::ParameterList& plist)
+{{
+  InitializeFromPlist_(plist);
+}}
+
+
+// Initialize parameters
+void
+{evalClassName}Model::InitializeFromPlist_(Teuchos::ParameterList& plist)
+{{{modelInitializeParamsList}}}
+
+
+// main method
+{modelMethodImplementation}
+
+// value and all partials in one pass
+{modelFusedImplementation}
+
+{modelDerivImplementationList}
+
+}} // namespace Relations
+}} // namespace {namespace}
+}} // namespace Amanzi
@@ -0,0 +1,3 @@
+  // Computes the value and, for each non-null pointer, the partial derivative
+  // with respect to that dependency, sharing common subexpressions.
+{declaration}
@@ -0,0 +1,5 @@
+double
+{signature}
+{{
+{myMethodImplementation}
+}}
@@ -1,15 +1,5 @@
-/*
-  Copyright 2010-202x held jointly by participating institutions.
-  ATS is released under the three-clause BSD License.
-  The terms of use and "as is" disclaimer for this license are
-  provided in the top-level COPYRIGHT file.
-
-  Authors:
-*/
-
-double{ evalClassName } Model::{ myMethod }({ myMethodDeclarationArgs }) const
-{
-  {
-    return { myMethodImplementation };
-  }
-}
+double
+{signature}
+{{
+{myMethodImplementation}
+}}
@@ -0,0 +1,9 @@
+
+  // Array kernel over n contiguous cells, inline to allow vectorization.
+{declaration}
+  {{
+#pragma omp simd
+    for (int i = 0; i < n; ++i) {{
+{myMethodImplementation}
+    }}
+  }}
@@ -4,30 +4,17 @@
   The terms of use and "as is" disclaimer for this license are
   provided in the top-level COPYRIGHT file.
 
-  Authors: Ethan Coon (ecoon@lanl.gov)
+  Authors:
 */
 
 /*
   The ideal gas equation of state evaluator is an algebraic evaluator of a given model.
 
-  Generated via evaluator_generator with:
-    modelInitializeParamsList =   cv_ = plist.get<double>("heat capacity");
-    evalName = eos_ideal_gas
-    modelMethodDeclaration =   double Density(double temp, double pres) const;
-    namespaceCaps = GENERAL
-    namespace = General
-    paramDeclarationList =   double cv_;
-    evalNameCaps = EOS_IDEAL_GAS
-    myMethodArgs = temp_v[0][i], pres_v[0][i]
-    myKeyMethod = Density
-    myKeyFirst = density
-    evalNameString = ideal gas equation of state
-    myMethodDeclarationArgs = double temp, double pres
-    evalClassName = EosIdealGas
-    myKey = density
-
+  Generated via evaluator_generator.
 */
 
+#include <array>
+
 #include "eos_ideal_gas_evaluator.hh"
 #include "eos_ideal_gas_model.hh"
 
@@ -37,7 +24,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 EosIdealGasEvaluator::EosIdealGasEvaluator(Teuchos::ParameterList& plist)
-  : EvaluatorSecondaryMonotypeCV(plist)
+  : EvaluatorSecondaryMonotypeCV(plist), partials_valid_(false)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("eos_ideal_gas parameters");
   model_ = Teuchos::rcp(new EosIdealGasModel(sublist));
@@ -45,12 +32,13 @@ EosIdealGasEvaluator::EosIdealGasEvaluator(Teuchos::ParameterList& plist)
 }
 
 
-// Copy constructor
+// Copy constructor, which does not share the cached partials
 EosIdealGasEvaluator::EosIdealGasEvaluator(const EosIdealGasEvaluator& other)
   : EvaluatorSecondaryMonotypeCV(other),
     temp_key_(other.temp_key_),
     pres_key_(other.pres_key_),
-    model_(other.model_)
+    model_(other.model_),
+    partials_valid_(false)
 {}
 
 
@@ -68,40 +56,36 @@ EosIdealGasEvaluator::InitializeFromPlist_()
 {
   // Set up my dependencies
   // - defaults to prefixed via domain
-  std::size_t end = my_key_.find_first_of("_");
-  std::string domain_name = my_key_.substr(0, end);
-
-  std::string my_key_first("density");
-  if (domain_name == my_key_first) {
-    domain_name = std::string("");
-  } else {
-    domain_name = domain_name + std::string("_");
-  }
+  Key domain_name = Keys::getDomain(my_keys_.front().first);
+  Tag tag = my_keys_.front().second;
 
   // - pull Keys from plist
   // dependency: temperature
-  temp_key_ = plist_.get<std::string>("temperature key", domain_name + std::string("temperature"));
-  dependencies_.insert(temp_key_);
+  temp_key_ = Keys::readKey(plist_, domain_name, "temperature", "temperature");
+  dependencies_.insert(KeyTag{ temp_key_, tag });
 
   // dependency: pressure
-  pres_key_ = plist_.get<std::string>("pressure key", domain_name + std::string("pressure"));
-  dependencies_.insert(pres_key_);
+  pres_key_ = Keys::readKey(plist_, domain_name, "pressure", "pressure");
+  dependencies_.insert(KeyTag{ pres_key_, tag });
 }
 
 
 void
-EosIdealGasEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
-                                     const Teuchos::Ptr<CompositeVector>& result)
+EosIdealGasEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
-  Teuchos::RCP<const CompositeVector> temp = S->GetFieldData(temp_key_);
-  Teuchos::RCP<const CompositeVector> pres = S->GetFieldData(pres_key_);
+  // the dependencies changed, so the cached partials are stale
+  partials_valid_ = false;
+
+  Tag tag = my_keys_.front().second;
+  Teuchos::RCP<const CompositeVector> temp = S.GetPtr<CompositeVector>(temp_key_, tag);
+  Teuchos::RCP<const CompositeVector> pres = S.GetPtr<CompositeVector>(pres_key_, tag);
 
-  for (CompositeVector::name_iterator comp = result->begin(); comp != result->end(); ++comp) {
+  for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end(); ++comp) {
     const Epetra_MultiVector& temp_v = *temp->ViewComponent(*comp, false);
     const Epetra_MultiVector& pres_v = *pres->ViewComponent(*comp, false);
-    Epetra_MultiVector& result_v = *result->ViewComponent(*comp, false);
+    Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
-    int ncomp = result->size(*comp, false);
+    int ncomp = result[0]->size(*comp, false);
     for (int i = 0; i != ncomp; ++i) {
       result_v[0][i] = model_->Density(temp_v[0][i], pres_v[0][i]);
     }
@@ -110,40 +94,52 @@ EosIdealGasEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
 
 
 void
-EosIdealGasEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
-                                                      Key wrt_key,
-                                                      const Teuchos::Ptr<CompositeVector>& result)
+EosIdealGasEvaluator::EvaluatePartialDerivative_(const State& S,
+                                                 const Key& wrt_key,
+                                                 const Tag& wrt_tag,
+                                                 const std::vector<CompositeVector*>& result)
 {
-  Teuchos::RCP<const CompositeVector> temp = S->GetFieldData(temp_key_);
-  Teuchos::RCP<const CompositeVector> pres = S->GetFieldData(pres_key_);
+  Tag tag = my_keys_.front().second;
+  Teuchos::RCP<const CompositeVector> temp = S.GetPtr<CompositeVector>(temp_key_, tag);
+  Teuchos::RCP<const CompositeVector> pres = S.GetPtr<CompositeVector>(pres_key_, tag);
+
+  const std::array<const Key*, 2> wrt_keys = { &temp_key_, &pres_key_ };
+  std::size_t k = 0;
+  while (k != wrt_keys.size() && *wrt_keys[k] != wrt_key) ++k;
+  AMANZI_ASSERT(k != wrt_keys.size());
+
+  // The DAG requests one partial at a time, but they share subexpressions, so
+  // every partial requested so far is computed in a single pass on the first
+  // request after Evaluate_() and then served from partials_.  Partials that
+  // are never requested are neither allocated nor computed.
+  if (partials_.size() != wrt_keys.size()) partials_.resize(wrt_keys.size());
+  if (partials_[k] == Teuchos::null) {
+    partials_[k] = Teuchos::rcp(new CompositeVector(result[0]->Map()));
+    partials_valid_ = false;
+  }
 
-  if (wrt_key == temp_key_) {
-    for (CompositeVector::name_iterator comp = result->begin(); comp != result->end(); ++comp) {
+  if (!partials_valid_) {
+    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
+         ++comp) {
       const Epetra_MultiVector& temp_v = *temp->ViewComponent(*comp, false);
       const Epetra_MultiVector& pres_v = *pres->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp, false);
-
-      int ncomp = result->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DDensityDTemperature(temp_v[0][i], pres_v[0][i]);
+      std::array<Epetra_MultiVector*, 2> d_v;
+      for (std::size_t j = 0; j != d_v.size(); ++j) {
+        d_v[j] =
+          partials_[j] == Teuchos::null ? nullptr : partials_[j]->ViewComponent(*comp, false).get();
       }
-    }
-
-  } else if (wrt_key == pres_key_) {
-    for (CompositeVector::name_iterator comp = result->begin(); comp != result->end(); ++comp) {
-      const Epetra_MultiVector& temp_v = *temp->ViewComponent(*comp, false);
-      const Epetra_MultiVector& pres_v = *pres->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp, false);
+      std::array<double*, 2> d;
 
-      int ncomp = result->size(*comp, false);
+      int ncomp = result[0]->size(*comp, false);
       for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DDensityDPressure(temp_v[0][i], pres_v[0][i]);
+        for (std::size_t j = 0; j != d.size(); ++j) d[j] = d_v[j] ? &(*d_v[j])[0][i] : nullptr;
+        model_->DensityAndDerivatives(temp_v[0][i], pres_v[0][i], d[0], d[1]);
       }
     }
-
-  } else {
-    AMANZI_ASSERT(0);
+    partials_valid_ = true;
   }
+
+  *result[0] = *partials_[k];
 }
 
 
@@ -11,20 +11,7 @@
   The ideal gas equation of state model is an algebraic model with dependencies.
 
   Generated via evaluator_generator with:
-    modelInitializeParamsList =   cv_ = plist.get<double>("heat capacity");
-    evalName = eos_ideal_gas
-    modelMethodDeclaration =   double Density(double temp, double pres) const;
-    namespaceCaps = GENERAL
-    namespace = General
-    paramDeclarationList =   double cv_;
-    evalNameCaps = EOS_IDEAL_GAS
-    myMethodArgs = temp_v[0][i], pres_v[0][i]
-    myKeyMethod = Density
-    myKeyFirst = density
-    evalNameString = ideal gas equation of state
-    myMethodDeclarationArgs = double temp, double pres
-    evalClassName = EosIdealGas
-    myKey = density
+
 
 */
 
@@ -55,19 +42,33 @@ EosIdealGasModel::InitializeFromPlist_(Teuchos::ParameterList& plist)
 double
 EosIdealGasModel::Density(double temp, double pres) const
 {
-  return AMANZI_ASSERT(False);
+  AMANZI_ASSERT(false);
+  return 0.;
+}
+
+// value and all partials in one pass
+double
+EosIdealGasModel::DensityAndDerivatives(double temp,
+                                        double pres,
+                                        double* d_temp,
+                                        double* d_pres) const
+{
+  AMANZI_ASSERT(false);
+  return 0.;
 }
 
 double
 EosIdealGasModel::DDensityDTemperature(double temp, double pres) const
 {
-  return AMANZI_ASSERT(False);
+  AMANZI_ASSERT(false);
+  return 0.;
 }
 
 double
 EosIdealGasModel::DDensityDPressure(double temp, double pres) const
 {
-  return AMANZI_ASSERT(False);
+  AMANZI_ASSERT(false);
+  return 0.;
 }
 
 } // namespace Relations
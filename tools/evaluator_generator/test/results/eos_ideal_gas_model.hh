@@ -11,20 +11,7 @@
   The ideal gas equation of state model is an algebraic model with dependencies.
 
   Generated via evaluator_generator with:
-    modelInitializeParamsList =   cv_ = plist.get<double>("heat capacity");
-    evalName = eos_ideal_gas
-    modelMethodDeclaration =   double Density(double temp, double pres) const;
-    namespaceCaps = GENERAL
-    namespace = General
-    paramDeclarationList =   double cv_;
-    evalNameCaps = EOS_IDEAL_GAS
-    myMethodArgs = temp_v[0][i], pres_v[0][i]
-    myKeyMethod = Density
-    myKeyFirst = density
-    evalNameString = ideal gas equation of state
-    myMethodDeclarationArgs = double temp, double pres
-    evalClassName = EosIdealGas
-    myKey = density
+
 
 */
 
@@ -41,6 +28,10 @@ class EosIdealGasModel {
 
   double Density(double temp, double pres) const;
 
+  // Computes the value and, for each non-null pointer, the partial derivative
+  // with respect to that dependency, sharing common subexpressions.
+  double DensityAndDerivatives(double temp, double pres, double* d_temp, double* d_pres) const;
+
   double DDensityDTemperature(double temp, double pres) const;
   double DDensityDPressure(double temp, double pres) const;
 
@@ -15,8 +15,7 @@
 
 */
 
-#ifndef AMANZI_GENERAL_EOS_IDEAL_GAS_EVALUATOR_HH_
-#define AMANZI_GENERAL_EOS_IDEAL_GAS_EVALUATOR_HH_
+#pragma once
 
 #include "Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
@@ -32,25 +31,32 @@ class EosIdealGasEvaluator : public EvaluatorSecondaryMonotypeCV {
   explicit EosIdealGasEvaluator(Teuchos::ParameterList& plist);
   EosIdealGasEvaluator(const EosIdealGasEvaluator& other);
 
-  virtual Teuchos::RCP<Evaluator> Clone() const;
-
-  // Required methods from EvaluatorSecondaryMonotypeCV
-  virtual void
-  EvaluateField_(const Teuchos::Ptr<State>& S, const Teuchos::Ptr<CompositeVector>& result);
-  virtual void EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
-                                               Key wrt_key,
-                                               const Teuchos::Ptr<CompositeVector>& result);
+  virtual Teuchos::RCP<Evaluator> Clone() const override;
 
   Teuchos::RCP<EosIdealGasModel> get_model() { return model_; }
 
  protected:
+  // Required methods from EvaluatorSecondaryMonotypeCV
+  virtual void Evaluate_(const State& S, const std::vector<CompositeVector*>& result) override;
+  virtual void EvaluatePartialDerivative_(const State& S,
+                                          const Key& wrt_key,
+                                          const Tag& wrt_tag,
+                                          const std::vector<CompositeVector*>& result) override;
+
   void InitializeFromPlist_();
 
+ protected:
   Key temp_key_;
   Key pres_key_;
 
   Teuchos::RCP<EosIdealGasModel> model_;
 
+  // partial derivatives with respect to each dependency, in the order above,
+  // null until first requested, and recomputed together on the first
+  // request after the value is updated
+  std::vector<Teuchos::RCP<CompositeVector>> partials_;
+  bool partials_valid_;
+
  private:
   static Utils::RegisteredFactory<Evaluator, EosIdealGasEvaluator> reg_;
 };
@@ -58,5 +64,3 @@ class EosIdealGasEvaluator : public EvaluatorSecondaryMonotypeCV {
 } // namespace Relations
 } // namespace General
 } // namespace Amanzi
-
-#endif
@@ -46,6 +46,18 @@ EosIdealGasModel::Density(double temp, double pres) const
   return cv_ * (-T0_ + temp);
 }
 
+// value and all partials in one pass
+double
+EosIdealGasModel::DensityAndDerivatives(double temp,
+                                        double pres,
+                                        double* d_temp,
+                                        double* d_pres) const
+{
+  if (d_temp) *d_temp = cv_;
+  if (d_pres) *d_pres = 0;
+  return cv_ * (-T0_ + temp);
+}
+
 double
 EosIdealGasModel::DDensityDTemperature(double temp, double pres) const
 {
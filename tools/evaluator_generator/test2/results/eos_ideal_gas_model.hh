@@ -28,6 +28,10 @@ class EosIdealGasModel {
 
   double Density(double temp, double pres) const;
 
+  // Computes the value and, for each non-null pointer, the partial derivative
+  // with respect to that dependency, sharing common subexpressions.
+  double DensityAndDerivatives(double temp, double pres, double* d_temp, double* d_pres) const;
+
   double DDensityDTemperature(double temp, double pres) const;
   double DDensityDPressure(double temp, double pres) const;
 